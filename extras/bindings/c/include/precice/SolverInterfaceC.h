@@ -75,6 +75,34 @@ void precicec_initialize_data();
  */
 double precicec_advance(double computedTimestepLength);
 
+/**
+ * @brief Starts to advance preCICE, completed by precicec_finishAdvance().
+ *
+ * @param[in] computedTimestepLength Length of timestep computed by solver.
+ */
+void precicec_startAdvance(double computedTimestepLength);
+
+/**
+ * @brief Completes advancing preCICE started by precicec_startAdvance().
+ *
+ * @return Maximal length of next timestep to be computed by solver.
+ */
+double precicec_finishAdvance();
+
+/**
+ * @brief Writes a restart checkpoint of the coupling state at the end of a time window.
+ *
+ * @param[in] directory Directory of the checkpoint files.
+ */
+void precicec_writeRestartCheckpoint(const char *directory);
+
+/**
+ * @brief Restarts the coupling from a checkpoint, has to be called before precicec_initialize().
+ *
+ * @param[in] directory Directory of the checkpoint files.
+ */
+void precicec_readRestartCheckpoint(const char *directory);
+
 /**
  * @brief Finalizes the coupling to the coupling supervisor.
  */
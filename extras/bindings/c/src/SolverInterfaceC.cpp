@@ -74,6 +74,30 @@ double precicec_advance(double computedTimestepLength)
   return impl->advance(computedTimestepLength);
 }
 
+void precicec_startAdvance(double computedTimestepLength)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->startAdvance(computedTimestepLength);
+}
+
+double precicec_finishAdvance()
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  return impl->finishAdvance();
+}
+
+void precicec_writeRestartCheckpoint(const char *directory)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->writeRestartCheckpoint(std::string(directory));
+}
+
+void precicec_readRestartCheckpoint(const char *directory)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->readRestartCheckpoint(std::string(directory));
+}
+
 void precicec_finalize()
 {
   PRECICE_CHECK(impl != nullptr, errormsg);
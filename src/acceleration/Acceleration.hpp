@@ -1,19 +1,14 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <istream>
 #include <map>
+#include <ostream>
 #include <vector>
 
 #include "cplscheme/BaseCouplingScheme.hpp"
 #include "cplscheme/SharedPointer.hpp"
 
-namespace precice {
-namespace io {
-class TXTWriter;
-class TXTReader;
-} // namespace io
-} // namespace precice
-
 namespace precice {
 namespace acceleration {
 
@@ -39,9 +34,11 @@ public:
 
   virtual void iterationsConverged(DataMap &cpldata) = 0;
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Writes the state, which is needed to restart the acceleration, in binary form.
+  virtual void exportState(std::ostream &out) {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Reads the state written by exportState(), has to be called after initialize().
+  virtual void importState(std::istream &in) {}
 
   /// Gives the number of QN columns that where filtered out (i.e. deleted) in this time window
   virtual int getDeletedColumns() const
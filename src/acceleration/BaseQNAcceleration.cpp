@@ -2,6 +2,7 @@
 #include <Eigen/Core>
 #include <cmath>
 #include <memory>
+#include <numeric>
 #include "acceleration/impl/Preconditioner.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
 #include "com/Communication.hpp"
@@ -10,6 +11,7 @@
 #include "logging/LogMacros.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
 #include "utils/Helpers.hpp"
@@ -17,10 +19,6 @@
 #include "utils/assertion.hpp"
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
 
 extern bool syncMode;
 namespace acceleration {
@@ -624,13 +622,51 @@ void BaseQNAcceleration::removeMatrixColumn(
 }
 
 void BaseQNAcceleration::exportState(
-    io::TXTWriter &writer)
+    std::ostream &out)
 {
+  PRECICE_TRACE(getLSSystemCols());
+  PRECICE_ASSERT(_firstIteration);
+
+  utils::writeBinary(out, _firstTimeStep);
+  utils::writeBinary(out, _resetLS);
+  utils::writeBinary(out, tSteps);
+  utils::writeBinary(out, _matrixV);
+  utils::writeBinary(out, _matrixW);
+  utils::writeBinary(out, _matrixCols);
+  utils::writeBinary(out, _matrixVBackup);
+  utils::writeBinary(out, _matrixWBackup);
+  utils::writeBinary(out, _matrixColsBackup);
+  _qrV.exportState(out);
+  _preconditioner->exportState(out);
 }
 
 void BaseQNAcceleration::importState(
-    io::TXTReader &reader)
+    std::istream &in)
 {
+  PRECICE_TRACE();
+  PRECICE_ASSERT(_firstIteration);
+
+  utils::readBinary(in, _firstTimeStep);
+  utils::readBinary(in, _resetLS);
+  utils::readBinary(in, tSteps);
+  utils::readBinary(in, _matrixV);
+  utils::readBinary(in, _matrixW);
+  utils::readBinary(in, _matrixCols);
+  utils::readBinary(in, _matrixVBackup);
+  utils::readBinary(in, _matrixWBackup);
+  utils::readBinary(in, _matrixColsBackup);
+  _qrV.importState(in);
+  PRECICE_CHECK(in, "Reading the state of the quasi-Newton acceleration from the restart checkpoint failed.");
+
+  const auto rows = _residuals.size();
+  PRECICE_CHECK((_matrixV.cols() == 0 || _matrixV.rows() == rows) && _matrixV.cols() == _matrixW.cols() && _matrixW.rows() == _matrixV.rows(),
+                "The quasi-Newton matrices of the restart checkpoint do not match the " << rows << " unknowns of the coupling interface. "
+                                                                                        << "Make sure to restart with the same mesh partition.");
+  // The QR decomposition may lack columns it discarded as linearly dependent, until the next filter rebuilds it.
+  const int cols = std::accumulate(_matrixCols.begin(), _matrixCols.end(), 0);
+  PRECICE_CHECK(not _matrixCols.empty() && (not _hasNodesOnInterface || (cols == _matrixV.cols() && _qrV.cols() <= cols)),
+                "The quasi-Newton matrices of the restart checkpoint are inconsistent.");
+  _preconditioner->importState(in);
 }
 
 int BaseQNAcceleration::getDeletedColumns() const
@@ -643,6 +679,11 @@ int BaseQNAcceleration::getDroppedColumns() const
   return _nbDropCols;
 }
 
+void BaseQNAcceleration::setOrthogonalization(impl::QRFactorization::Orthogonalization orthogonalization)
+{
+  _qrV.setOrthogonalization(orthogonalization);
+}
+
 int BaseQNAcceleration::getLSSystemCols() const
 {
   int cols = 0;
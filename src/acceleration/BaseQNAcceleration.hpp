@@ -4,7 +4,9 @@
 #include <algorithm>
 #include <deque>
 #include <fstream>
+#include <istream>
 #include <map>
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -49,11 +51,6 @@
 // ----------------------------------------------------------- CLASS DEFINITION
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
-
 namespace acceleration {
 
 /**
@@ -114,16 +111,18 @@ public:
   virtual void iterationsConverged(DataMap &cplData);
 
   /**
-    * @brief Exports the current state of the acceleration to a file.
+    * @brief Exports the least-squares system, its QR decomposition and the preconditioner.
+    *
+    * Has to be called at the end of a time window, i.e., after iterationsConverged().
     */
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void exportState(std::ostream &out);
 
   /**
-    * @brief Imports the last exported state of the acceleration from file.
+    * @brief Imports the state written by exportState().
     *
-    * Is empty at the moment!!!
+    * Has to be called after initialize() and before the first iteration of a time window.
     */
-  virtual void importState(io::TXTReader &reader);
+  virtual void importState(std::istream &in);
 
   /// how many QN columns were deleted in this timestep
   virtual int getDeletedColumns() const;
@@ -140,6 +139,9 @@ public:
     */
   virtual int getLSSystemCols() const;
 
+  /// Sets the variant of the Gram-Schmidt process used to update the QR decomposition of _matrixV
+  void setOrthogonalization(impl::QRFactorization::Orthogonalization orthogonalization);
+
 protected:
   logging::Logger _log{"acceleration::BaseQNAcceleration"};
 
@@ -9,6 +9,7 @@
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -122,5 +123,22 @@ void BroydenAcceleration::specializedIterationsConverged(
   // store old Jacobian
   _oldInvJacobian = _invJacobian;
 }
+
+void BroydenAcceleration::exportState(
+    std::ostream &out)
+{
+  BaseQNAcceleration::exportState(out);
+  utils::writeBinary(out, _oldInvJacobian);
+}
+
+void BroydenAcceleration::importState(
+    std::istream &in)
+{
+  BaseQNAcceleration::importState(in);
+  const Eigen::Index size = _oldInvJacobian.rows();
+  utils::readBinary(in, _oldInvJacobian);
+  PRECICE_CHECK(in && _oldInvJacobian.rows() == size && _oldInvJacobian.cols() == size,
+                "The inverse Jacobian of the restart checkpoint does not match the " << size << " unknowns of the coupling interface.");
+}
 } // namespace acceleration
 } // namespace precice
@@ -58,6 +58,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the common quasi-Newton state and the inverse Jacobian of the last time window.
+  virtual void exportState(std::ostream &out);
+
+  /// Imports the state written by exportState().
+  virtual void importState(std::istream &in);
+
 private:
   // remove this ofter debugging, not useful
   // ---------------------------------------
@@ -1,6 +1,7 @@
 #include "acceleration/IQNILSAcceleration.hpp"
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include "acceleration/impl/Preconditioner.hpp"
@@ -11,6 +12,7 @@
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
@@ -263,6 +265,37 @@ void IQNILSAcceleration::specializedIterationsConverged(
   }
 }
 
+void IQNILSAcceleration::exportState(
+    std::ostream &out)
+{
+  BaseQNAcceleration::exportState(out);
+  // Secondary data is stored in the configured order, which does not depend on data IDs.
+  utils::writeBinary(out, static_cast<std::int64_t>(_secondaryDataIDs.size()));
+  for (int id : _secondaryDataIDs) {
+    utils::writeBinary(out, _secondaryMatricesW[id]);
+    utils::writeBinary(out, _secondaryMatricesWBackup[id]);
+  }
+}
+
+void IQNILSAcceleration::importState(
+    std::istream &in)
+{
+  BaseQNAcceleration::importState(in);
+  std::int64_t secondaryDataCount = 0;
+  utils::readBinary(in, secondaryDataCount);
+  PRECICE_CHECK(in && secondaryDataCount == static_cast<std::int64_t>(_secondaryDataIDs.size()),
+                "The restart checkpoint contains " << secondaryDataCount << " secondary data, but the IQN-ILS acceleration uses "
+                                                   << _secondaryDataIDs.size() << ". Make sure to restart with the same configuration.");
+  for (int id : _secondaryDataIDs) {
+    utils::readBinary(in, _secondaryMatricesW[id]);
+    utils::readBinary(in, _secondaryMatricesWBackup[id]);
+    PRECICE_CHECK(in, "Reading the state of the IQN-ILS acceleration from the restart checkpoint failed.");
+    const Eigen::MatrixXd &secW = _secondaryMatricesW[id];
+    PRECICE_CHECK(secW.cols() == _matrixW.cols() && (secW.cols() == 0 || secW.rows() == _secondaryResiduals[id].size()),
+                  "The secondary data matrices of the restart checkpoint do not match secondary data with ID " << id << '.');
+  }
+}
+
 void IQNILSAcceleration::removeMatrixColumn(
     int columnIndex)
 {
@@ -48,6 +48,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the common quasi-Newton state and the W matrices of the secondary data.
+  virtual void exportState(std::ostream &out);
+
+  /// Imports the state written by exportState().
+  virtual void importState(std::istream &in);
+
 private:
   /// Secondary data solver output from last iteration.
   std::map<int, Eigen::VectorXd> _secondaryOldXTildes;
@@ -15,6 +15,7 @@
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
@@ -47,6 +48,7 @@ MVQNAcceleration::MVQNAcceleration(
       _Wtil(),
       _WtilChunk(),
       _pseudoInverseChunk(),
+      _matrixVChunk(),
       _matrixV_RSLS(),
       _matrixW_RSLS(),
       _matrixCols_RSLS(),
@@ -583,10 +585,7 @@ void MVQNAcceleration::restartIMVJ()
       qr.setGlobalRows(getLSSystemRows());
       // for QR2-filter, the QR-dec is computed in qr-applyFilter()
       if (_filter != Acceleration::QR2FILTER) {
-        for (int i = 0; i < (int) _matrixV_RSLS.cols(); i++) {
-          Eigen::VectorXd v = _matrixV_RSLS.col(i);
-          qr.pushBack(v); // same order as matrix V_RSLS
-        }
+        qr.appendColumns(_matrixV_RSLS); // same order as matrix V_RSLS
       }
 
       // apply filter
@@ -668,6 +667,40 @@ void MVQNAcceleration::restartIMVJ()
       _pseudoInverseChunk.erase(_pseudoInverseChunk.begin());
     }
 
+  } else if (_imvjRestartType == MVQNAcceleration::RS_LM) {
+
+    // drop the oldest pair Wtil^0, Z^0 and re-compute Wtil^q of all remaining pairs, such that the recursion
+    // Wtil^q = W^q - J^(q-1) * V^q with J^(q-1) = sum_{p<q} Wtil^p * Z^p starts with J = 0 at the second oldest pair:
+    //    Wtil^q <-- Wtil^q + D^q,  with  D^q = Wtil^0 * (Z^0*V^q) - sum_{0<p<q} D^p * (Z^p*V^q)
+    // only the products Z^p*V^q of size (m x m) are reduced, the Jacobian is never assembled.
+    PRECICE_ASSERT(_matrixVChunk.size() == _WtilChunk.size(), _matrixVChunk.size(), _WtilChunk.size());
+    std::vector<Eigen::MatrixXd> corrections(_WtilChunk.size());
+    for (int q = 1; q < (int) _WtilChunk.size(); q++) {
+      const Eigen::MatrixXd &V = _matrixVChunk[q];
+      corrections[q]           = Eigen::MatrixXd::Zero(V.rows(), V.cols());
+      for (int p = 0; p < q; p++) {
+        int colsLSSystemBackThen = _pseudoInverseChunk[p].rows();
+        PRECICE_ASSERT(colsLSSystemBackThen == _WtilChunk[p].cols(), colsLSSystemBackThen, _WtilChunk[p].cols());
+        Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, V.cols());
+        // multiply: ZV := Z^p * V^q of size (m x m) with m=#cols, stored on each proc.
+        _parMatrixOps->multiply(_pseudoInverseChunk[p], V, ZV, colsLSSystemBackThen, getLSSystemRows(), V.cols());
+        // multiply: D^p * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
+        if (p == 0) {
+          corrections[q].noalias() += _WtilChunk.front() * ZV;
+        } else {
+          corrections[q].noalias() -= corrections[p] * ZV;
+        }
+      }
+    }
+    for (int q = 1; q < (int) _WtilChunk.size(); q++) {
+      _WtilChunk[q] += corrections[q];
+    }
+
+    // drop oldest pair Wtil_0 and Z_0
+    _WtilChunk.erase(_WtilChunk.begin());
+    _pseudoInverseChunk.erase(_pseudoInverseChunk.begin());
+    _matrixVChunk.erase(_matrixVChunk.begin());
+
   } else if (_imvjRestartType == MVQNAcceleration::NO_RESTART) {
     PRECICE_ASSERT(false); // should not happen, in this case _imvjRestart=false
   } else {
@@ -744,6 +777,10 @@ void MVQNAcceleration::specializedIterationsConverged(
       // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
       _WtilChunk.push_back(_Wtil);
       _pseudoInverseChunk.push_back(Z);
+      // the limited-memory mode re-computes Wtil^q from V^q when older pairs are dropped
+      if (_imvjRestartType == RS_LM) {
+        _matrixVChunk.push_back(_matrixV);
+      }
 
       /**
        *  Restart the IMVJ according to restart type
@@ -779,6 +816,58 @@ void MVQNAcceleration::specializedIterationsConverged(
   }
 }
 
+// ==================================================================================
+void MVQNAcceleration::exportState(
+    std::ostream &out)
+{
+  PRECICE_TRACE();
+  BaseQNAcceleration::exportState(out);
+
+  utils::writeBinary(out, _Wtil);
+  if (_imvjRestart) {
+    utils::writeBinary(out, _WtilChunk);
+    utils::writeBinary(out, _pseudoInverseChunk);
+    utils::writeBinary(out, _matrixVChunk);
+    utils::writeBinary(out, _matrixV_RSLS);
+    utils::writeBinary(out, _matrixW_RSLS);
+    utils::writeBinary(out, _matrixCols_RSLS);
+    utils::writeBinary(out, _nbRestarts);
+    _svdJ.exportState(out);
+  } else {
+    utils::writeBinary(out, _oldInvJacobian);
+  }
+}
+
+// ==================================================================================
+void MVQNAcceleration::importState(
+    std::istream &in)
+{
+  PRECICE_TRACE();
+  BaseQNAcceleration::importState(in);
+
+  utils::readBinary(in, _Wtil);
+  if (_imvjRestart) {
+    utils::readBinary(in, _WtilChunk);
+    utils::readBinary(in, _pseudoInverseChunk);
+    utils::readBinary(in, _matrixVChunk);
+    utils::readBinary(in, _matrixV_RSLS);
+    utils::readBinary(in, _matrixW_RSLS);
+    utils::readBinary(in, _matrixCols_RSLS);
+    utils::readBinary(in, _nbRestarts);
+    _svdJ.importState(in);
+    PRECICE_CHECK(in && _WtilChunk.size() == _pseudoInverseChunk.size(),
+                  "Reading the restart chunks of the IMVJ acceleration from the restart checkpoint failed.");
+  } else {
+    const Eigen::Index rows = _oldInvJacobian.rows();
+    const Eigen::Index cols = _oldInvJacobian.cols();
+    utils::readBinary(in, _oldInvJacobian);
+    PRECICE_CHECK(in && _oldInvJacobian.rows() == rows && _oldInvJacobian.cols() == cols,
+                  "The inverse Jacobian of the restart checkpoint does not match the " << cols
+                                                                                       << " unknowns of the coupling interface. "
+                                                                                       << "Make sure to restart with the same restart mode and mesh partition.");
+  }
+}
+
 // ==================================================================================
 void MVQNAcceleration::removeMatrixColumn(
     int columnIndex)
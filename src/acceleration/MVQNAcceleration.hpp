@@ -37,6 +37,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int RS_LM      = 5;
 
   /**
    * @brief Constructor.
@@ -74,6 +75,17 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /**
+    * @brief Exports the common quasi-Newton state and the (truncated) approximation of the inverse Jacobian.
+    *
+    * Depending on the restart mode, this is the inverse Jacobian of the last time window, the chunks
+    * of the restart modes or the truncated SVD.
+    */
+  virtual void exportState(std::ostream &out);
+
+  /// Imports the state written by exportState().
+  virtual void importState(std::istream &in);
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time step.
   Eigen::MatrixXd _invJacobian;
@@ -90,6 +102,9 @@ private:
   /// @brief stores all pseudo inverses within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
   std::vector<Eigen::MatrixXd> _pseudoInverseChunk;
 
+  /// @brief stores the matrices V belonging to the pairs Wtil^q and Z^q if RS-LM restart-mode is active
+  std::vector<Eigen::MatrixXd> _matrixVChunk;
+
   /// @brief stores columns from previous  #_RSLSreusedTimesteps time steps if RS-LS restart-mode is active
   Eigen::MatrixXd _matrixV_RSLS;
 
@@ -116,6 +131,8 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *  - RS-LM:      imvj in limited-memory mode. Only the pairs Wtil^q, Z^q of the last M time steps are
+    *                kept, the oldest pair is dropped and the remaining pairs are re-computed.
     */
   int _imvjRestartType;
 
@@ -188,6 +205,9 @@ private:
     *  RS-LS:   Perform a IQN-LS least squares initial guess with _RSLSreusedTimesteps
     *  RS-SVD:  Update a truncated SVD decomposition of the SVD with rank-1 modifications from Wtil*Z
     *  RS-Zero: Start with zero information, initial guess J = 0.
+    *  RS-LM:   Drop the oldest pair Wtil^0, Z^0 and re-compute the remaining Wtil^q, such that
+    *           sum_q Wtil^q * Z^q is the Jacobian the IMVJ recursion yields when started with J = 0
+    *           one time step later.
     */
   void restartIMVJ();
 
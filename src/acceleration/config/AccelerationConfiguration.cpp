@@ -7,6 +7,7 @@
 #include <vector>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/AitkenAcceleration.hpp"
+#include "acceleration/BaseQNAcceleration.hpp"
 #include "acceleration/BroydenAcceleration.hpp"
 #include "acceleration/ConstantRelaxationAcceleration.hpp"
 #include "acceleration/IQNILSAcceleration.hpp"
@@ -42,6 +43,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_ORTHOGONALIZATION("orthogonalization"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -70,7 +72,10 @@ AccelerationConfiguration::AccelerationConfiguration(
       VALUE_ZERO_RESTART("RS-0"),
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
+      VALUE_LM_RESTART("RS-LM"),
       VALUE_NO_RESTART("no-restart"),
+      VALUE_GRAM_SCHMIDT("gram-schmidt"),
+      VALUE_CGS2("cgs2"),
       _meshConfig(meshConfig),
       _acceleration(),
       _neededMeshes(),
@@ -210,6 +215,15 @@ void AccelerationConfiguration::xmlTagCallback(
       PRECICE_ASSERT(false);
     }
     _config.singularityLimit = callingTag.getDoubleAttributeValue(ATTR_SINGULARITYLIMIT);
+  } else if (callingTag.getName() == TAG_ORTHOGONALIZATION) {
+    auto f = callingTag.getStringAttributeValue(ATTR_TYPE);
+    if (f == VALUE_GRAM_SCHMIDT) {
+      _config.orthogonalization = impl::QRFactorization::Orthogonalization::GramSchmidt;
+    } else if (f == VALUE_CGS2) {
+      _config.orthogonalization = impl::QRFactorization::Orthogonalization::CGS2;
+    } else {
+      PRECICE_ASSERT(false);
+    }
   } else if (callingTag.getName() == TAG_PRECONDITIONER) {
     _config.preconditionerType       = callingTag.getStringAttributeValue(ATTR_TYPE);
     _config.precond_nbNonConstTSteps = callingTag.getIntAttributeValue(ATTR_PRECOND_NONCONST_TIME_WINDOWS);
@@ -234,6 +248,11 @@ void AccelerationConfiguration::xmlTagCallback(
       _config.imvjRestartType         = MVQNAcceleration::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = MVQNAcceleration::RS_SLIDE;
+    } else if (f == VALUE_LM_RESTART) {
+      PRECICE_CHECK(_config.imvjChunkSize > 0,
+                    "IMVJ restart-mode RS-LM needs to store the pairs of at least one time window, "
+                        << "but chunk-size is " << _config.imvjChunkSize << ". Please increase the chunk-size.");
+      _config.imvjRestartType = MVQNAcceleration::RS_LM;
     } else {
       _config.imvjChunkSize = 0;
       PRECICE_ASSERT(false);
@@ -331,6 +350,10 @@ void AccelerationConfiguration::xmlEndTagCallback(
     } else {
       PRECICE_ASSERT(false);
     }
+
+    if (auto qnAcceleration = std::dynamic_pointer_cast<BaseQNAcceleration>(_acceleration)) {
+      qnAcceleration->setOrthogonalization(_config.orthogonalization);
+    }
   }
 }
 
@@ -379,6 +402,19 @@ void AccelerationConfiguration::addCommonIQNSubtags(xml::XMLTag &tag)
                             .setDocumentation("Type of the filter.");
   tagFilter.addAttribute(attrFilterName);
   tag.addSubtag(tagFilter);
+
+  XMLTag tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+  tagOrthogonalization.setDocumentation("Variant of the Gram-Schmidt process, which orthogonalizes new columns "
+                                        "of the least-squares system in the QR decomposition. Possible variants:\n"
+                                        " - `gram-schmidt`: one global reduction per column of the least-squares system\n"
+                                        " - `cgs2`: classical Gram-Schmidt with reorthogonalization, one global reduction "
+                                        "per orthogonalization pass. Recommended for runs on many ranks.");
+  auto attrOrthogonalizationType = XMLAttribute<std::string>(ATTR_TYPE, VALUE_GRAM_SCHMIDT)
+                                       .setOptions({VALUE_GRAM_SCHMIDT,
+                                                    VALUE_CGS2})
+                                       .setDocumentation("Type of the orthogonalization.");
+  tagOrthogonalization.addAttribute(attrOrthogonalizationType);
+  tag.addSubtag(tagOrthogonalization);
 }
 
 void AccelerationConfiguration::addTypeSpecificSubtags(
@@ -471,7 +507,8 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                             VALUE_ZERO_RESTART,
                                             VALUE_LS_RESTART,
                                             VALUE_SVD_RESTART,
-                                            VALUE_SLIDE_RESTART})
+                                            VALUE_SLIDE_RESTART,
+                                            VALUE_LM_RESTART})
                                .setDefaultValue(VALUE_SVD_RESTART)
                                .setDocumentation("Type of the restart mode.");
     tagIMVJRESTART.addAttribute(attrRestartName);
@@ -480,9 +517,11 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                     "- `RS-ZERO`:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "- `RS-LS`:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "- `RS-SVD`:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
-                                    "- `RS-SLIDE`:   IMVJ runs in sliding window restart mode.\n");
+                                    "- `RS-SLIDE`:   IMVJ runs in sliding window restart mode.\n"
+                                    "- `RS-LM`:      IMVJ runs in limited-memory mode. Only the low-rank factors of the last M time steps are stored, the Jacobian is never assembled.\n");
     auto attrChunkSize = makeXMLAttribute(ATTR_IMVJCHUNKSIZE, 8)
-                             .setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
+                             .setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. "
+                                               "For restart-mode=RS-LM, the number of time steps whose low-rank factors are stored. Defaul value is M=8.");
     auto attrReusedTimeWindowsAtRestart = makeXMLAttribute(ATTR_RSLS_REUSED_TIME_WINDOWS, 8)
                                               .setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time steps at restart can be specified.");
     auto attrRSSVD_truncationEps = makeXMLAttribute(ATTR_RSSVD_TRUNCATIONEPS, 1e-4)
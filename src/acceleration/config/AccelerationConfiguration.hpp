@@ -6,6 +6,7 @@
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/MVQNAcceleration.hpp"
 #include "acceleration/SharedPointer.hpp"
+#include "acceleration/impl/QRFactorization.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -52,6 +53,7 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_ORTHOGONALIZATION;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -82,7 +84,10 @@ private:
   const std::string VALUE_ZERO_RESTART;
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
+  const std::string VALUE_LM_RESTART;
   const std::string VALUE_NO_RESTART;
+  const std::string VALUE_GRAM_SCHMIDT;
+  const std::string VALUE_CGS2;
 
   const mesh::PtrMeshConfiguration _meshConfig;
 
@@ -115,6 +120,8 @@ private:
     bool                  estimateJacobian           = false;
     bool                  alwaysBuildJacobian        = false;
     std::string           preconditionerType;
+
+    impl::QRFactorization::Orthogonalization orthogonalization = impl::QRFactorization::Orthogonalization::GramSchmidt;
   } _config;
 
   void addTypeSpecificSubtags(xml::XMLTag &tag);
@@ -7,11 +7,18 @@ namespace precice {
 namespace acceleration {
 namespace impl {
 
-void ParallelMatrixOperations::initialize(const bool needCyclicComm)
+void ParallelMatrixOperations::initialize(const bool needCyclicComm, const bool useCollectives)
 {
   PRECICE_TRACE();
 
-  if (needCyclicComm && (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave())) {
+  // MPI collectives are only available if master and slaves share a communicator
+  if (useCollectives) {
+    if (auto masterSlaveCom = std::dynamic_pointer_cast<com::MPIDirectCommunication>(utils::MasterSlave::_communication)) {
+      _collectiveComm = masterSlaveCom->collectiveCommunicator();
+    }
+  }
+
+  if (needCyclicComm && _collectiveComm == MPI_COMM_NULL && (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave())) {
     _needCyclicComm = true;
     establishCircularCommunication();
   } else {
@@ -4,10 +4,12 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <mpi.h>
 #include <stddef.h>
 #include <string>
 #include <vector>
 #include "com/Communication.hpp"
+#include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunication.hpp"
 #include "com/Request.hpp"
 #include "com/SharedPointer.hpp"
@@ -24,8 +26,14 @@ class ParallelMatrixOperations {
 public:
   ~ParallelMatrixOperations();
 
-  /// Initializes the acceleration.
-  void initialize(const bool needCyclicComm);
+  /**
+   * @brief Initializes the acceleration.
+   *
+   * @param[in] needCyclicComm Products with a quadratic (n_global x n_global) result are computed
+   * @param[in] useCollectives Use MPI collectives instead of the cyclic communication and the master,
+   *            if the master-slave communication is a MPIDirectCommunication
+   */
+  void initialize(const bool needCyclicComm, const bool useCollectives = true);
 
   template <typename Derived1, typename Derived2>
   void multiply(
@@ -53,13 +61,17 @@ public:
       // if p equals r (and p = global_n), we have to perform the
       // cyclic communication with block-wise matrix-matrix multiplication
       if (p == r) {
-        PRECICE_ASSERT(_needCyclicComm);
-        PRECICE_ASSERT(_cyclicCommLeft.get() != NULL);
-        PRECICE_ASSERT(_cyclicCommLeft->isConnected());
-        PRECICE_ASSERT(_cyclicCommRight.get() != NULL);
-        PRECICE_ASSERT(_cyclicCommRight->isConnected());
-
-        _multiplyNN(leftMatrix, rightMatrix, result, offsets, p, q, r);
+        if (_collectiveComm != MPI_COMM_NULL) {
+          _multiplyNN_allgather(leftMatrix, rightMatrix, result, offsets, p, q, r);
+        } else {
+          PRECICE_ASSERT(_needCyclicComm);
+          PRECICE_ASSERT(_cyclicCommLeft.get() != NULL);
+          PRECICE_ASSERT(_cyclicCommLeft->isConnected());
+          PRECICE_ASSERT(_cyclicCommRight.get() != NULL);
+          PRECICE_ASSERT(_cyclicCommRight->isConnected());
+
+          _multiplyNN(leftMatrix, rightMatrix, result, offsets, p, q, r);
+        }
 
         // case p != r, i.e., usually p = number of columns of the least squares system
         // perform parallel multiplication based on dot-product
@@ -137,82 +149,106 @@ private:
     PRECICE_ASSERT(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     PRECICE_ASSERT(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::getRank() + 1) % utils::MasterSlave::getSize();
-    int prevProc = (utils::MasterSlave::getRank() - 1 < 0) ? utils::MasterSlave::getSize() - 1 : utils::MasterSlave::getRank() - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    const int size = utils::MasterSlave::getSize();
+    const int rank = utils::MasterSlave::getRank();
 
+    // the blocks of leftMatrix (W_til) travel to the next proc in each cycle. Two receive buffers are used alternately,
+    // such that the block of the next cycle is received and the current block is handed over, while the current block
+    // is multiplied. Only the buffer of the next cycle has to wait for the hand over of the previous cycle.
+    Eigen::MatrixXd leftMatrix_rcv[2];
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
 
+    // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning of a cycle
+    auto sourceProc = [&](int cycle) { return (rank - cycle + size) % size; };
+
     // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
     if (leftMatrix.size() > 0)
       requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+    leftMatrix_rcv[1].resize(offsets[sourceProc(1) + 1] - offsets[sourceProc(1)], q);
+    if (size > 1 && leftMatrix_rcv[1].size() > 0)
+      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv[1].data(), leftMatrix_rcv[1].size(), 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::getRank()];
-    PRECICE_ASSERT(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    int off = offsets[rank];
+    PRECICE_ASSERT(result.cols() == leftMatrix.rows(), result.cols(), leftMatrix.rows());
+    result.block(off, 0, leftMatrix.rows(), rightMatrix.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
-		 * cyclic send-receive operation
-		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::getSize(); cycle++) {
+     * cyclic send-receive operation
+     */
+    for (int cycle = 1; cycle < size; cycle++) {
+      Eigen::MatrixXd &current = leftMatrix_rcv[cycle % 2];
+      Eigen::MatrixXd &next    = leftMatrix_rcv[(cycle + 1) % 2];
 
       // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
-      if (requestRcv != NULL)
+      if (requestRcv != NULL) {
         requestRcv->wait();
-
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::getSize() - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
+        requestRcv = nullptr;
+      }
+      // the buffer of the next cycle is handed over in the previous cycle
+      if (requestSend != NULL) {
+        requestSend->wait();
+        requestSend = nullptr;
       }
 
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::getRank() - (cycle + 1) < 0) ? utils::MasterSlave::getSize() + (utils::MasterSlave::getRank() - (cycle + 1)) : utils::MasterSlave::getRank() - (cycle + 1);
-
-      int sourceProc = (utils::MasterSlave::getRank() - cycle < 0) ? utils::MasterSlave::getSize() + (utils::MasterSlave::getRank() - cycle) : utils::MasterSlave::getRank() - cycle;
-
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
+      if (cycle < size - 1) {
+        // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
+        if (current.size() > 0)
+          requestSend = _cyclicCommRight->aSend(current.data(), current.size(), 0);
 
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::getSize() - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+        // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
+        next.resize(offsets[sourceProc(cycle + 1) + 1] - offsets[sourceProc(cycle + 1)], q);
+        if (next.size() > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(next.data(), next.size(), 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
+      // compute block with received data, while the transfers of the next cycle are in flight
       // set block at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
-      off = offsets[sourceProc];
-      PRECICE_ASSERT(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      off = offsets[sourceProc(cycle)];
+      result.block(off, 0, current.rows(), rightMatrix.cols()).noalias() = current * rightMatrix;
+    }
+
+    if (requestSend != NULL)
+      requestSend->wait();
+  }
+
+  /// Multiplies matrices like _multiplyNN, but gathers the distributed leftMatrix on all procs using MPI_Allgatherv.
+  template <typename Derived1, typename Derived2>
+  void _multiplyNN_allgather(
+      Eigen::PlainObjectBase<Derived1> &leftMatrix,
+      Eigen::PlainObjectBase<Derived2> &rightMatrix,
+      Eigen::PlainObjectBase<Derived2> &result,
+      const std::vector<int> &          offsets,
+      int p, int q, int r)
+  {
+    PRECICE_TRACE();
+    PRECICE_ASSERT(_collectiveComm != MPI_COMM_NULL);
+    PRECICE_ASSERT(leftMatrix.cols() == q, leftMatrix.cols(), q);
+    PRECICE_ASSERT(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
+    PRECICE_ASSERT(result.rows() == p, result.rows(), p);
+    PRECICE_ASSERT(offsets.back() == p, offsets.back(), p);
+
+    // the rows of leftMatrix (W_til) are distributed, the columns of its transpose are contiguous in memory
+    const int        size = utils::MasterSlave::getSize();
+    std::vector<int> counts(size), displacements(size);
+    for (int rank = 0; rank < size; rank++) {
+      counts[rank]        = (offsets[rank + 1] - offsets[rank]) * q;
+      displacements[rank] = offsets[rank] * q;
     }
+    Eigen::MatrixXd leftTransposed = leftMatrix.transpose();
+    Eigen::MatrixXd gathered(q, p);
+    MPI_Allgatherv(leftTransposed.data(), leftTransposed.size(), MPI_DOUBLE,
+                   gathered.data(), counts.data(), displacements.data(), MPI_DOUBLE, _collectiveComm);
+
+    // dimension: (n_global x m) * (m x n_local) = (n_global x n_local)
+    result.noalias() = gathered.transpose() * rightMatrix;
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
@@ -276,6 +312,21 @@ private:
     // Note: if procs have no vertices, the block size remains (n_global x m), however,
     // 	     it must be initialized with zeros, so zeros are added for those procs)
 
+    // sum up the blocks and scatter the sub blocks to the procs in one collective operation
+    if (_collectiveComm != MPI_COMM_NULL) {
+      // the rows of each proc are contiguous in memory in the transposed block
+      const int        size = utils::MasterSlave::getSize();
+      std::vector<int> counts(size);
+      for (int rank = 0; rank < size; rank++) {
+        counts[rank] = (offsets[rank + 1] - offsets[rank]) * r;
+      }
+      Eigen::MatrixXd blockTransposed = block.transpose();
+      Eigen::MatrixXd resultTransposed(r, result.rows());
+      MPI_Reduce_scatter(blockTransposed.data(), resultTransposed.data(), counts.data(), MPI_DOUBLE, MPI_SUM, _collectiveComm);
+      result = resultTransposed.transpose();
+      return;
+    }
+
     // sum up blocks in master, reduce
     Eigen::MatrixXd summarizedBlocks = Eigen::MatrixXd::Zero(p, r); /// @todo: only master should allocate memory.
     utils::MasterSlave::reduceSum(block.data(), summarizedBlocks.data(), block.size());
@@ -313,6 +364,9 @@ private:
 
   bool _needCyclicComm = true;
 
+  /// Communicator of the master and all slaves, if collectives are used instead of the cyclic communication
+  MPI_Comm _collectiveComm = MPI_COMM_NULL;
+
   /** Establishes the circular connection between slaves
    *
    * This creates and connects the slaves.
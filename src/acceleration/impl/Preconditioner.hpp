@@ -1,11 +1,14 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <istream>
+#include <ostream>
 #include <vector>
 
 #include "cplscheme/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -202,6 +205,31 @@ public:
     return _frozen;
   }
 
+  /// Writes the weights and the update state in binary form, see importState()
+  virtual void exportState(std::ostream &out) const
+  {
+    utils::writeBinary(out, _weights);
+    utils::writeBinary(out, _invWeights);
+    utils::writeBinary(out, _nbNonConstTimesteps);
+    utils::writeBinary(out, _requireNewQR);
+    utils::writeBinary(out, _frozen);
+  }
+
+  /// Restores the state written by exportState(), has to be called after initialize()
+  virtual void importState(std::istream &in)
+  {
+    PRECICE_TRACE();
+    const size_t size = _weights.size();
+    utils::readBinary(in, _weights);
+    utils::readBinary(in, _invWeights);
+    utils::readBinary(in, _nbNonConstTimesteps);
+    utils::readBinary(in, _requireNewQR);
+    utils::readBinary(in, _frozen);
+    PRECICE_CHECK(in && _weights.size() == size && _invWeights.size() == size,
+                  "The preconditioner weights of the restart checkpoint do not match the " << size
+                                                                                           << " unknowns of the coupling interface.");
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
   std::vector<double> _weights;
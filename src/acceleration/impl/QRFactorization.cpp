@@ -1,7 +1,9 @@
 #include "acceleration/impl/QRFactorization.hpp"
+#include <Eigen/Cholesky>
 #include <Eigen/Core>
 #include <algorithm> // std::sort
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <stddef.h>
@@ -10,6 +12,7 @@
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
@@ -17,6 +20,28 @@ namespace precice {
 namespace acceleration {
 namespace impl {
 
+namespace {
+/// Columns with ||v_orth|| / ||v|| below this limit cannot be resolved by the Gram matrix of a block
+constexpr double blockResolutionLimit = 1e-5;
+
+/// Returns [Q(:,1:m)^T W; W^T W] summed over all ranks, computed with a single reduction.
+Eigen::MatrixXd reduceProjections(const Eigen::MatrixXd &Q, int m, const Eigen::MatrixXd &W)
+{
+  Eigen::MatrixXd local(m + W.cols(), W.cols());
+  if (m > 0) {
+    local.topRows(m).noalias() = Q.leftCols(m).transpose() * W;
+  }
+  local.bottomRows(W.cols()).noalias() = W.transpose() * W;
+
+  if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave()) {
+    return local;
+  }
+  Eigen::MatrixXd global(local.rows(), local.cols());
+  utils::MasterSlave::allreduceSum(local.data(), global.data(), local.size());
+  return global;
+}
+} // namespace
+
 QRFactorization::QRFactorization(
     Eigen::MatrixXd Q,
     Eigen::MatrixXd R,
@@ -67,10 +92,7 @@ QRFactorization::QRFactorization(
       _globalRows(A.rows())
 {
   int m = A.cols();
-  for (int k = 0; k < m; k++) {
-    Eigen::VectorXd v = A.col(k);
-    insertColumn(k, v);
-  }
+  appendColumns(A);
   //PRECICE_ASSERT(_R.rows() == _cols, _R.rows(), _cols);
   PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
   PRECICE_ASSERT(_Q.cols() == _cols, _Q.cols(), _cols);
@@ -108,6 +130,9 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
     bool             linearDependence = true;
     std::vector<int> delFlag(_cols, 0);
     int              delCols = 0;
+    // the rotations of all deletions are accumulated in G and applied to Q at once
+    Eigen::MatrixXd G     = Eigen::MatrixXd::Identity(_cols, _cols);
+    int             first = _cols;
     while (linearDependence) {
       linearDependence = false;
       int index        = 0; // actual index of checked column, \in [0, _cols] and _cols is decreasing
@@ -125,7 +150,8 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
           if (std::fabs(_R(index, index)) < singularityLimit * factor) {
 
             linearDependence = true;
-            deleteColumn(index);
+            rotateOutColumn(index, G);
+            first = std::min(first, index);
             delFlag[i]++;
             delIndices.push_back(i);
             delCols++;
@@ -137,6 +163,9 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
         }
       }
     }
+    if (delCols > 0) {
+      applyRotations(G, first);
+    }
   } else if (_filter == Acceleration::QR2FILTER) {
     _Q.resize(0, 0);
     _R.resize(0, 0);
@@ -144,14 +173,7 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
     _rows = V.rows();
     // starting with the most recent input/output information, i.e., the latest column
     // which is at position 0 in _matrixV (latest information is never filtered out!)
-    for (int k = 0; k < V.cols(); k++) {
-      Eigen::VectorXd v = V.col(k);
-      // this is the same as pushBack(v) as _cols grows within the insertion process
-      bool inserted = insertColumn(_cols, v, singularityLimit);
-      if (!inserted) {
-        delIndices.push_back(k);
-      }
-    }
+    delIndices = appendColumns(V, singularityLimit);
   }
   std::sort(delIndices.begin(), delIndices.end());
 }
@@ -168,6 +190,158 @@ void QRFactorization::deleteColumn(int k)
   PRECICE_ASSERT(k >= 0, k);
   PRECICE_ASSERT(k < _cols, k, _cols);
 
+  rotateOutColumn(k, _Q);
+
+  PRECICE_ASSERT(_Q.cols() == _cols, _Q.cols(), _cols);
+  PRECICE_ASSERT(_Q.rows() == _rows, _Q.rows(), _rows);
+  PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
+  //PRECICE_ASSERT(_R.rows() == _cols, _Q.rows(), _cols);
+}
+
+std::vector<int> QRFactorization::appendColumns(const Eigen::MatrixXd &V, double singularityLimit)
+{
+  PRECICE_TRACE(V.cols());
+
+  std::vector<int> discarded;
+  if (V.cols() == 0) {
+    return discarded;
+  }
+  if (_cols == 0) {
+    _rows = V.rows();
+  }
+  PRECICE_ASSERT(V.rows() == _rows, V.rows(), _rows);
+  if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave()) {
+    PRECICE_ASSERT(_globalRows == _rows, _globalRows, _rows);
+  }
+
+  const int m = _cols;
+  const int p = V.cols();
+
+  // first pass: S = Q^T V and the Gram matrix of V_orth = V - Q S
+  const Eigen::MatrixXd projections = reduceProjections(_Q, m, V);
+  const auto            S           = projections.topRows(m);
+  const Eigen::MatrixXd C           = projections.bottomRows(p) - S.transpose() * S;
+
+  // Cholesky factorization C = L L^T restricted to the accepted columns. A column is accepted, discarded
+  // by the QR2-filter or left to insertColumn, if its orthogonal part cannot be resolved.
+  std::vector<int> accepted;
+  Eigen::MatrixXd  L    = Eigen::MatrixXd::Zero(p, p);
+  int              next = 0;
+  for (; next < p; next++) {
+    const int q = accepted.size();
+    // treat the special case m=n in insertColumn
+    if (m + q >= _globalRows) {
+      break;
+    }
+    Eigen::VectorXd l(q);
+    for (int a = 0; a < q; a++) {
+      l(a) = (C(accepted[a], next) - L.row(a).head(a).dot(l.head(a))) / L(a, a);
+    }
+    const double rho0Squared = projections(m + next, next);   // ||v||^2
+    const double rhoSquared  = C(next, next) - l.squaredNorm(); // ||v_orth||^2
+
+    if (singularityLimit >= blockResolutionLimit && rhoSquared < singularityLimit * singularityLimit * rho0Squared) {
+      PRECICE_DEBUG("discarding column " << next << " as it is filtered out by the QR2-filter");
+      discarded.push_back(next);
+      continue;
+    }
+    if (rhoSquared <= blockResolutionLimit * blockResolutionLimit * rho0Squared) {
+      break;
+    }
+    L.row(q).head(q) = l;
+    L(q, q)          = std::sqrt(rhoSquared);
+    accepted.push_back(next);
+  }
+
+  if (not accepted.empty()) {
+    const int       q = accepted.size();
+    Eigen::MatrixXd W(_rows, q);
+    Eigen::MatrixXd R12(m, q);
+    for (int a = 0; a < q; a++) {
+      W.col(a)   = V.col(accepted[a]);
+      R12.col(a) = S.col(accepted[a]);
+    }
+    if (m > 0) {
+      W.noalias() -= _Q.leftCols(m) * R12;
+    }
+    Eigen::MatrixXd R22 = L.topLeftCorner(q, q).transpose();
+    R22.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(W);
+
+    // second pass: reorthogonalize W = V_orth * R22^-1 to Q and itself
+    const Eigen::MatrixXd       projections2 = reduceProjections(_Q, m, W);
+    const auto                  S2           = projections2.topRows(m);
+    Eigen::LLT<Eigen::MatrixXd> llt(projections2.bottomRows(q) - S2.transpose() * S2);
+
+    if (llt.info() == Eigen::Success) {
+      if (m > 0) {
+        W.noalias() -= _Q.leftCols(m) * S2;
+      }
+      const Eigen::MatrixXd R2 = llt.matrixU();
+      R2.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(W);
+      R12 += S2 * R22;
+      R22 = (R2.triangularView<Eigen::Upper>() * R22).eval();
+
+      _Q.conservativeResize(_rows, m + q);
+      _Q.rightCols(q) = W;
+      _R.conservativeResize(m + q, m + q);
+      _R.topRightCorner(m, q)    = R12;
+      _R.bottomLeftCorner(q, m)  = Eigen::MatrixXd::Zero(q, m);
+      _R.bottomRightCorner(q, q) = R22.triangularView<Eigen::Upper>();
+      _cols                      = m + q;
+    } else {
+      // the block is too ill-conditioned, insert all columns from the first accepted one on one by one
+      next = accepted.front();
+      discarded.erase(std::lower_bound(discarded.begin(), discarded.end(), next), discarded.end());
+    }
+  }
+
+  if (next < p) {
+    PRECICE_DEBUG("Inserting " << p - next << " of " << p << " columns one by one into the QR-factorization.");
+  }
+  for (int k = next; k < p; k++) {
+    if (not insertColumn(_cols, V.col(k), singularityLimit)) {
+      discarded.push_back(k);
+    }
+  }
+
+  PRECICE_ASSERT(_Q.cols() == _cols, _Q.cols(), _cols);
+  PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
+  return discarded;
+}
+
+void QRFactorization::deleteColumns(std::vector<int> indices)
+{
+  PRECICE_TRACE(indices.size());
+
+  if (indices.empty()) {
+    return;
+  }
+  if (indices.size() == 1) {
+    deleteColumn(indices.front());
+    return;
+  }
+
+  // delete from the back, such that the remaining indices stay valid
+  std::sort(indices.begin(), indices.end(), std::greater<int>());
+  PRECICE_ASSERT(std::adjacent_find(indices.begin(), indices.end()) == indices.end());
+  PRECICE_ASSERT(indices.back() >= 0, indices.back());
+  PRECICE_ASSERT(indices.front() < _cols, indices.front(), _cols);
+
+  Eigen::MatrixXd G = Eigen::MatrixXd::Identity(_cols, _cols);
+  for (int k : indices) {
+    rotateOutColumn(k, G);
+  }
+  applyRotations(G, indices.back());
+
+  PRECICE_ASSERT(_Q.cols() == _cols, _Q.cols(), _cols);
+  PRECICE_ASSERT(_Q.rows() == _rows, _Q.rows(), _rows);
+  PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
+}
+
+void QRFactorization::rotateOutColumn(int k, Eigen::MatrixXd &Q)
+{
+  PRECICE_ASSERT(Q.cols() == _cols, Q.cols(), _cols);
+
   // maintain decomposition and orthogonalization by application of givens rotations
 
   for (int l = k; l < _cols - 1; l++) {
@@ -178,11 +352,11 @@ void QRFactorization::deleteColumn(int k)
     applyReflector(grot, l + 2, _cols, Rr1, Rr2);
     _R.row(l)           = Rr1;
     _R.row(l + 1)       = Rr2;
-    Eigen::VectorXd Qc1 = _Q.col(l);
-    Eigen::VectorXd Qc2 = _Q.col(l + 1);
-    applyReflector(grot, 0, _rows, Qc1, Qc2);
-    _Q.col(l)     = Qc1;
-    _Q.col(l + 1) = Qc2;
+    Eigen::VectorXd Qc1 = Q.col(l);
+    Eigen::VectorXd Qc2 = Q.col(l + 1);
+    applyReflector(grot, 0, Q.rows(), Qc1, Qc2);
+    Q.col(l)     = Qc1;
+    Q.col(l + 1) = Qc2;
   }
   // copy values and resize R and Q
   for (int j = k; j < _cols - 1; j++) {
@@ -191,14 +365,18 @@ void QRFactorization::deleteColumn(int k)
     }
   }
   _R.conservativeResize(_cols - 1, _cols - 1);
-  //_Q.conservativeResize(Eigen::NoChange_t, _cols-1);
-  _Q.conservativeResize(_rows, _cols - 1);
+  Q.conservativeResize(Q.rows(), _cols - 1);
   _cols--;
+}
 
-  PRECICE_ASSERT(_Q.cols() == _cols, _Q.cols(), _cols);
-  PRECICE_ASSERT(_Q.rows() == _rows, _Q.rows(), _rows);
-  PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
-  //PRECICE_ASSERT(_R.rows() == _cols, _Q.rows(), _cols);
+void QRFactorization::applyRotations(const Eigen::MatrixXd &G, int first)
+{
+  PRECICE_ASSERT(G.rows() == _Q.cols(), G.rows(), _Q.cols());
+  PRECICE_ASSERT(G.cols() == _cols, G.cols(), _cols);
+
+  Eigen::MatrixXd trailing = _Q.rightCols(G.rows() - first) * G.bottomRightCorner(G.rows() - first, _cols - first);
+  _Q.conservativeResize(_rows, _cols);
+  _Q.rightCols(_cols - first) = trailing;
 }
 
 // ATTENTION: This method works on the memory of vector v, thus changes the vector v.
@@ -225,7 +403,9 @@ bool QRFactorization::insertColumn(int k, const Eigen::VectorXd &vec, double sin
   if (applyFilter)
     rho0 = utils::MasterSlave::l2norm(v);
 
-  int err = orthogonalize(v, u, rho_orth, _cols - 1);
+  int err = (_orthogonalization == Orthogonalization::CGS2)
+                ? orthogonalize_cgs2(v, u, rho_orth, _cols - 1)
+                : orthogonalize(v, u, rho_orth, _cols - 1);
 
   // on of the following is true
   // - either ||v_orth|| / ||v|| <= 0.7 was true and the re-orthogonalization process failed 4 times
@@ -412,6 +592,110 @@ int QRFactorization::orthogonalize(
   return k;
 }
 
+/**
+ * @short communication-avoiding variant of orthogonalize(). Each pass computes
+ *   the local parts of s = Q(:,1:m)^T v and ||v||^2 and sums them up in one
+ *   allreduce. The norm of v_orth is obtained by Pythagoras, which is accurate
+ *   whenever the iteration terminates, as ||v_orth|| / ||v|| > 1/theta holds then.
+ *   If reorthogonalization is necessary, the next pass reduces the exact ||v||^2.
+ *
+ *   @return Returns the number of gram-schmidt iterations needed to orthogobalize the
+ *   new vector to the existing system. If more then 4 iterations were needed, -1 is
+ *   returned and the new column should not be inserted into the system.
+ */
+int QRFactorization::orthogonalize_cgs2(
+    Eigen::VectorXd &v,
+    Eigen::VectorXd &r,
+    double &         rho,
+    int              colNum)
+{
+  PRECICE_TRACE();
+
+  if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave()) {
+    PRECICE_ASSERT(_globalRows == _rows, _globalRows, _rows);
+  }
+
+  bool   null        = false;
+  bool   termination = false;
+  double rho0 = 0., rho1 = 0.;
+
+  r = Eigen::VectorXd::Zero(_cols);
+
+  // [Q(:,1:m)^T v; ||v||^2], local and reduced
+  Eigen::VectorXd localProjections(colNum + 1);
+  Eigen::VectorXd projections(colNum + 1);
+
+  int k = 0;
+  while (!termination) {
+
+    // take a gram-schmidt iteration with a single reduction
+    if (colNum > 0) {
+      localProjections.head(colNum) = _Q.leftCols(colNum).transpose() * v;
+    }
+    localProjections(colNum) = v.squaredNorm();
+    if (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave()) {
+      utils::MasterSlave::allreduceSum(localProjections.data(), projections.data(), colNum + 1);
+    } else {
+      projections = localProjections;
+    }
+    const auto s = projections.head(colNum);
+
+    if (k == 0) {
+      rho  = std::sqrt(projections(colNum));
+      rho0 = rho;
+    }
+
+    // add the furier coefficients over all orthogonalize iterations
+    r.head(colNum) += s;
+    // subtract projections from v, v is now orthogonal to columns of _Q
+    if (colNum > 0) {
+      v -= _Q.leftCols(colNum) * s;
+    }
+
+    // rho1 = norm of orthogonalized new column v_tilde (though not normalized)
+    const double norm_coefficients = s.norm();
+    rho1                           = std::sqrt(std::max(projections(colNum) - norm_coefficients * norm_coefficients, 0.));
+    k++;
+
+    // treat the special case m=n
+    // Attention (Master-Slave): Here, we need to compare the global _rows with colNum and NOT the local
+    // rows on the processor.
+    if (_globalRows == colNum) {
+      PRECICE_WARN("The least-squares system matrix is quadratic, i.e., the new column cannot be orthogonalized (and thus inserted) to the LS-system.\nOld columns need to be removed.");
+      v   = Eigen::VectorXd::Zero(_rows);
+      rho = 0.;
+      return k;
+    }
+
+    // take correct action if v_orth is null
+    // In the first pass, rho1 may vanish due to cancellation, the reorthogonalization computes it exactly.
+    if (k > 1 && rho1 <= std::numeric_limits<double>::min()) {
+      PRECICE_DEBUG("The norm of v_orthogonal is almost zero, i.e., failed to orthogonalize column v; discard.");
+      null        = true;
+      rho1        = 1;
+      termination = true;
+    }
+
+    // re-orthogonalize if: ||v_orth|| / ||v|| <= 1/theta, see orthogonalize()
+    if (rho1 * _theta <= rho0 + _omega * norm_coefficients) {
+      // exit to fail if too many iterations
+      if (k >= 4) {
+        PRECICE_WARN("Matrix Q is not sufficiently orthogonal. Failed to rorthogonalize new column after 4 iterations. New column will be discarded. The least-squares system is very bad conditioned and the quasi-Newton will most probably fail to converge.");
+        return -1;
+      }
+      rho0 = rho1;
+    } else {
+      termination = true;
+    }
+  }
+
+  // normalize v
+  v /= rho1;
+  rho       = null ? 0 : rho1;
+  r(colNum) = rho;
+  return k;
+}
+
 /**
  * @short assuming Q(1:n,1:m) has nearly orthonormal columns, this procedure
  *   orthogonlizes v(1:n) to the columns of Q, and normalizes the result.
@@ -727,15 +1011,9 @@ void QRFactorization::reset(
   _sigma      = sigma;
   _globalRows = globalRows;
 
-  int m   = A.cols();
-  int col = 0, k = 0;
-  for (; col < m; k++, col++) {
-    Eigen::VectorXd v        = A.col(col);
-    bool            inserted = insertColumn(k, v);
-    if (not inserted) {
-      k--;
-      PRECICE_DEBUG("column " << col << " has not been inserted in the QR-factorization, failed to orthogonalize.");
-    }
+  int m = A.cols();
+  for (int col : appendColumns(A)) {
+    PRECICE_DEBUG("column " << col << " has not been inserted in the QR-factorization, failed to orthogonalize.");
   }
   PRECICE_ASSERT(_R.rows() == _cols, _R.rows(), _cols);
   PRECICE_ASSERT(_R.cols() == _cols, _R.cols(), _cols);
@@ -775,6 +1053,29 @@ void QRFactorization::setFilter(int filter)
   _filter = filter;
 }
 
+void QRFactorization::setOrthogonalization(Orthogonalization orthogonalization)
+{
+  _orthogonalization = orthogonalization;
+}
+
+void QRFactorization::exportState(std::ostream &out) const
+{
+  utils::writeBinary(out, _Q);
+  utils::writeBinary(out, _R);
+  utils::writeBinary(out, _rows);
+  utils::writeBinary(out, _cols);
+  utils::writeBinary(out, _globalRows);
+}
+
+void QRFactorization::importState(std::istream &in)
+{
+  utils::readBinary(in, _Q);
+  utils::readBinary(in, _R);
+  utils::readBinary(in, _rows);
+  utils::readBinary(in, _cols);
+  utils::readBinary(in, _globalRows);
+}
+
 } // namespace impl
 } // namespace acceleration
 } // namespace precice
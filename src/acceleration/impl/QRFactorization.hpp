@@ -2,7 +2,9 @@
 
 #include <Eigen/Core>
 #include <fstream>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <string>
 #include <vector>
 #include "logging/Logger.hpp"
@@ -22,6 +24,14 @@ namespace impl {
  */
 class QRFactorization {
 public:
+  /// Variant of the Gram-Schmidt process, which orthogonalizes an inserted column to the columns of Q
+  enum class Orthogonalization {
+    /// One distributed reduction per column of Q and per norm, see orthogonalize()
+    GramSchmidt,
+    /// Classical Gram-Schmidt with reorthogonalization, one distributed reduction per pass, see orthogonalize_cgs2()
+    CGS2
+  };
+
   /**
    * @brief Constructor.
    * @param theta - singularity limit for reothogonalization ||v_orth|| / ||v|| <= 1/theta
@@ -95,12 +105,34 @@ public:
     */
   bool insertColumn(int k, const Eigen::VectorXd &v, double singularityLimit = 0);
 
+  /**
+   * @brief appends all columns of V at the end and updates the QR factorization en block.
+   *
+   * The block is orthogonalized to the columns of Q by a block classical Gram-Schmidt process with
+   * reorthogonalization, which needs one distributed reduction per pass instead of one per column and
+   * norm. The triangular factor of the block follows from a Cholesky factorization of its Gram matrix.
+   * Columns, which cannot be resolved by the Gram matrix, are inserted one by one using insertColumn.
+   *
+   * @param [in] singularityLimit - if > 0, a column is discarded if ||v_orth|| < singularityLimit * ||v||,
+   *                                like in insertColumn
+   * @return indices of the columns of V, which were discarded
+   */
+  std::vector<int> appendColumns(const Eigen::MatrixXd &V, double singularityLimit = 0);
+
   /**
    * @brief updates the factorization A=Q[1:n,1:m]R[1:m,1:n] when the kth column of A is deleted.
    * Returns the deleted column v(1:n)
    */
   void deleteColumn(int k);
 
+  /**
+   * @brief deletes the given columns and updates the QR factorization.
+   *
+   * The givens rotations are only applied to R and accumulated in a small matrix, which is applied
+   * to Q in a single matrix-matrix product.
+   */
+  void deleteColumns(std::vector<int> indices);
+
   /**
     * @brief inserts a new column at position 0, i.e., shifts right and inserts at first position
     * and updates the QR factorization.
@@ -158,6 +190,15 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief sets the variant of the Gram-Schmidt process used to insert columns
+  void setOrthogonalization(Orthogonalization orthogonalization);
+
+  // @brief writes the factors and dimensions in binary form, see importState()
+  void exportState(std::ostream &out) const;
+
+  // @brief restores the factorization written by exportState()
+  void importState(std::istream &in);
+
 private:
   struct givensRot {
     int    i, j;
@@ -191,6 +232,14 @@ private:
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @short same as orthogonalize(), but all projections <Q(:,j), v> of a Gram-Schmidt pass
+   *   are computed from the same v and reduced together with ||v||^2 in a single allreduce.
+   *   The norm of the orthogonalized column follows from ||v_orth||^2 = ||v||^2 - ||s||^2,
+   *   hence one pass costs one reduction instead of colNum + 2 reductions.
+   */
+  int orthogonalize_cgs2(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -202,6 +251,19 @@ private:
   */
   void applyReflector(const givensRot &grot, int k, int l, Eigen::VectorXd &p, Eigen::VectorXd &q);
 
+  /**
+  * @short deletes the kth column of R, restores the triangular form of R by givens rotations,
+  *  which are also applied to the columns of Q, and removes the last column of Q.
+  *  Q is either _Q or a matrix, which accumulates the rotations for a later update of _Q.
+  */
+  void rotateOutColumn(int k, Eigen::MatrixXd &Q);
+
+  /**
+  * @short replaces _Q by _Q * G, where G accumulates the rotations of rotateOutColumn().
+  *  G is the identity in its first columns, hence only the columns from first on are multiplied.
+  */
+  void applyRotations(const Eigen::MatrixXd &G, int first);
+
   logging::Logger _log{"acceleration::QRFactorization"};
 
   Eigen::MatrixXd _Q;
@@ -220,6 +282,8 @@ private:
   bool          _fstream_set;
 
   int _globalRows;
+
+  Orthogonalization _orthogonalization = Orthogonalization::GramSchmidt;
 };
 
 } // namespace impl
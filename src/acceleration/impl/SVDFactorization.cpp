@@ -3,6 +3,7 @@
 #include "acceleration/impl/SVDFactorization.hpp"
 #include <Eigen/Core>
 #include <limits>
+#include "utils/BinaryIO.hpp"
 #include "utils/MasterSlave.hpp"
 
 namespace precice {
@@ -298,6 +299,30 @@ int SVDFactorization::rank()
   return _cols;
 }
 
+void SVDFactorization::exportState(std::ostream &out) const
+{
+  utils::writeBinary(out, _psi);
+  utils::writeBinary(out, _phi);
+  utils::writeBinary(out, _sigma);
+  utils::writeBinary(out, _rows);
+  utils::writeBinary(out, _cols);
+  utils::writeBinary(out, _waste);
+  utils::writeBinary(out, _preconditionerApplied);
+  utils::writeBinary(out, _initialSVD);
+}
+
+void SVDFactorization::importState(std::istream &in)
+{
+  utils::readBinary(in, _psi);
+  utils::readBinary(in, _phi);
+  utils::readBinary(in, _sigma);
+  utils::readBinary(in, _rows);
+  utils::readBinary(in, _cols);
+  utils::readBinary(in, _waste);
+  utils::readBinary(in, _preconditionerApplied);
+  utils::readBinary(in, _initialSVD);
+}
+
 } // namespace impl
 } // namespace acceleration
 } // namespace precice
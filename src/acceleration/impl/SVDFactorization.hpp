@@ -11,7 +11,9 @@
 #include <Eigen/Core>
 #include <Eigen/Dense>
 #include <fstream>
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <string>
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
 #include "acceleration/impl/Preconditioner.hpp"
@@ -237,6 +239,12 @@ public:
   /// Optional file-stream for logging output
   void setfstream(std::fstream *stream);
 
+  /// @brief: writes the truncated SVD and its dimensions in binary form, see importState()
+  void exportState(std::ostream &out) const;
+
+  /// @brief: restores the truncated SVD written by exportState(), has to be called after initialize()
+  void importState(std::istream &in);
+
 private:
   /** @brief: computes the QR decomposition of a matrix A of type A = PSI^T*A \in R^(rank x n)
    *
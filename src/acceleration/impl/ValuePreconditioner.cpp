@@ -1,6 +1,7 @@
 #include "acceleration/impl/ValuePreconditioner.hpp"
 #include <stddef.h>
 #include <vector>
+#include "utils/BinaryIO.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
@@ -15,6 +16,18 @@ ValuePreconditioner::ValuePreconditioner(
 {
 }
 
+void ValuePreconditioner::exportState(std::ostream &out) const
+{
+  Preconditioner::exportState(out);
+  utils::writeBinary(out, _firstTimestep);
+}
+
+void ValuePreconditioner::importState(std::istream &in)
+{
+  Preconditioner::importState(in);
+  utils::readBinary(in, _firstTimestep);
+}
+
 void ValuePreconditioner::_update_(bool                   timestepComplete,
                                    const Eigen::VectorXd &oldValues,
                                    const Eigen::VectorXd &res)
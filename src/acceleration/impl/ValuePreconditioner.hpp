@@ -19,6 +19,10 @@ public:
    */
   virtual ~ValuePreconditioner() {}
 
+  virtual void exportState(std::ostream &out) const override;
+
+  virtual void importState(std::istream &in) override;
+
 private:
   logging::Logger _log{"acceleration::ValuePreconditioner"};
 
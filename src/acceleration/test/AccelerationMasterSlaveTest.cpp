@@ -22,6 +22,7 @@
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/MasterSlave.hpp"
 
 using namespace precice;
 using namespace precice::cplscheme;
@@ -960,6 +961,108 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp)
   }
 }
 
+/**
+ * @brief Solves a weakly nonlinear fixed-point problem x = H_t(x) for several time windows with the given acceleration.
+ *
+ * The 12 entries are distributed as 3, 4, 0, 5 over the 4 processors.
+ * Returns the converged local values of all time windows and stores the needed iterations per time window.
+ */
+std::vector<Eigen::VectorXd> runIMVJTimeWindows(MVQNAcceleration &acc, const testing::TestContext &context, int timeWindows, std::vector<int> &iterations)
+{
+  std::vector<int> vertexOffsets{3, 7, 7, 12};
+  mesh::PtrMesh    dummyMesh(new mesh::Mesh("DummyMesh", 3, false, testing::nextMeshID()));
+  dummyMesh->setVertexOffsets(vertexOffsets);
+
+  int rank   = context.rank;
+  int offset = (rank == 0) ? 0 : vertexOffsets[rank - 1];
+  int size   = vertexOffsets[rank] - offset;
+
+  mesh::PtrData displacements(new mesh::Data("dvalues", -1, 1));
+  displacements->values() = Eigen::VectorXd::Zero(size);
+  PtrCouplingData dpcd(new CouplingData(displacements, dummyMesh, false));
+  DataMap         data;
+  data.insert(std::pair<int, PtrCouplingData>(0, dpcd));
+  acc.initialize(data);
+  dpcd->oldValues.col(0) = Eigen::VectorXd::Zero(size);
+
+  std::vector<Eigen::VectorXd> results;
+  for (int t = 0; t < timeWindows; t++) {
+    int k = 0;
+    while (true) {
+      // H_t(x)_i = d_i * x_i + 0.1 * sin(x_i) + (1 + 0.1 * t) * c_i
+      Eigen::VectorXd x = dpcd->oldValues.col(0);
+      for (int i = 0; i < size; i++) {
+        int global        = offset + i;
+        dpcd->values()(i) = (0.3 + 0.05 * global) * x(i) + 0.1 * std::sin(x(i)) + (1.0 + 0.1 * t) * (1.0 + 0.1 * global);
+      }
+      k++;
+      if (utils::MasterSlave::l2norm(dpcd->values() - x) < 1e-10 || k == 50) {
+        break;
+      }
+      acc.performAcceleration(data);
+      dpcd->oldValues.col(0) = dpcd->values();
+    }
+    acc.iterationsConverged(data);
+    dpcd->oldValues.col(0) = dpcd->values();
+    results.push_back(dpcd->values());
+    iterations.push_back(k);
+  }
+  return results;
+}
+
+/// Test that runs on 4 processors.
+BOOST_AUTO_TEST_CASE(testIMVJ_limitedMemory_pp)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  double              initialRelaxation        = 0.1;
+  int                 maxIterationsUsed        = 30;
+  int                 timestepsReused          = 0;
+  int                 filter                   = BaseQNAcceleration::QR2FILTER;
+  double              singularityLimit         = 1e-2;
+  bool                enforceInitialRelaxation = false;
+  std::vector<int>    dataIDs{0};
+  std::vector<double> factors{1.0};
+  int                 timeWindows = 6;
+
+  // normal mode with explicit representation of the Jacobian
+  std::vector<int>  iterationsJacobian;
+  PtrPreconditioner precJacobian(new ConstantPreconditioner(factors));
+  MVQNAcceleration  accJacobian(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                               timestepsReused, filter, singularityLimit, dataIDs, precJacobian, false,
+                               MVQNAcceleration::NO_RESTART, 0, 0, 0.0);
+  auto              resultsJacobian = runIMVJTimeWindows(accJacobian, context, timeWindows, iterationsJacobian);
+
+  // limited-memory mode, which stores the factors of all time windows, is identical to the normal mode
+  std::vector<int>  iterationsAll;
+  PtrPreconditioner precAll(new ConstantPreconditioner(factors));
+  MVQNAcceleration  accAll(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                          timestepsReused, filter, singularityLimit, dataIDs, precAll, false,
+                          MVQNAcceleration::RS_LM, timeWindows, 0, 0.0);
+  auto              resultsAll = runIMVJTimeWindows(accAll, context, timeWindows, iterationsAll);
+
+  BOOST_TEST(iterationsAll == iterationsJacobian, boost::test_tools::per_element());
+  for (int t = 0; t < timeWindows; t++) {
+    for (int i = 0; i < resultsJacobian[t].size(); i++) {
+      BOOST_TEST(testing::equals(resultsAll[t](i), resultsJacobian[t](i), 1e-8));
+    }
+  }
+
+  // limited-memory mode, which drops the oldest factors, still converges
+  std::vector<int>  iterationsLimited;
+  PtrPreconditioner precLimited(new ConstantPreconditioner(factors));
+  MVQNAcceleration  accLimited(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+                              timestepsReused, filter, singularityLimit, dataIDs, precLimited, false,
+                              MVQNAcceleration::RS_LM, 2, 0, 0.0);
+  auto              resultsLimited = runIMVJTimeWindows(accLimited, context, timeWindows, iterationsLimited);
+
+  for (int t = 0; t < timeWindows; t++) {
+    BOOST_TEST(iterationsLimited[t] < 50);
+    for (int i = 0; i < resultsJacobian[t].size(); i++) {
+      BOOST_TEST(testing::equals(resultsLimited[t](i), resultsJacobian[t](i), 1e-8));
+    }
+  }
+}
+
 /// Test that runs on 4 processors.
 BOOST_AUTO_TEST_CASE(testColumnsLogging)
 {
@@ -284,43 +284,47 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp)
     Jres_local(i)    = Jres_global(i + off);
   }
 
-  // initialize ParallelMatrixOperations object
-  ParallelMatrixOperations parMatrixOps{};
-  parMatrixOps.initialize(true);
-
-  /*
-   * test parallel multiplications
-   */
-  BOOST_TEST_MESSAGE("Test 1");
-  // 1.) multiply JW = J * W (n x m), parallel: (n_local x m)
-  Eigen::MatrixXd resJW_local(n_local, m_global);
-  parMatrixOps.multiply(J_local, W_local, resJW_local, vertexOffsets, n_global, n_global, m_global);
-  validate_result_equals_reference(resJW_local, JW_global, vertexOffsets.at(context.rank), true);
-
-  BOOST_TEST_MESSAGE("Test 2");
-  // 2.) multiply WZ = W * Z (n x n), parallel: (n_global x n_local)
-  Eigen::MatrixXd resWZ_local(n_global, n_local);
-  parMatrixOps.multiply(W_local, Z_local, resWZ_local, vertexOffsets, n_global, m_global, n_global);
-  validate_result_equals_reference(resWZ_local, WZ_global, vertexOffsets.at(context.rank), false);
-
-  BOOST_TEST_MESSAGE("Test 3");
-  // 3.) multiply Jres = J * res (n x 1), parallel: (n_local x 1)
-  Eigen::MatrixXd resJres_local(n_local, 1);
-  parMatrixOps.multiply(J_local, res_local, resJres_local, vertexOffsets, n_global, n_global, 1);
-  validate_result_equals_reference(resJres_local, Jres_global, vertexOffsets.at(context.rank), true);
-
-  BOOST_TEST_MESSAGE("Test 4");
-  // 4.) multiply JW = J * W (n x m), parallel: (n_local x m) with block-wise multiplication
-  Eigen::MatrixXd resJW_local2(n_local, m_global);
-  parMatrixOps.multiply(J_local, W_local, resJW_local2, vertexOffsets, n_global, n_global, m_global, false);
-  validate_result_equals_reference(resJW_local2, JW_global, vertexOffsets.at(context.rank), true);
-
-  BOOST_TEST_MESSAGE("Test 5");
-  // 5.) multiply Jres = J * res (n x 1), parallel: (n_local x 1) with block-wise multiplication
-  Eigen::VectorXd resJres_local2(n_local); // use the function with parameter of type Eigen::VectorXd
-  parMatrixOps.multiply(J_local, res_local_vec, resJres_local2, vertexOffsets, n_global, n_global, 1, false);
-  Eigen::MatrixXd matrix_cast = resJres_local2;
-  validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets.at(context.rank), true);
+  // the cyclic communication and the MPI collectives have to yield the same results
+  for (bool useCollectives : {false, true}) {
+    BOOST_TEST_MESSAGE("Use collectives: " << useCollectives);
+    // initialize ParallelMatrixOperations object
+    ParallelMatrixOperations parMatrixOps{};
+    parMatrixOps.initialize(true, useCollectives);
+
+    /*
+     * test parallel multiplications
+     */
+    BOOST_TEST_MESSAGE("Test 1");
+    // 1.) multiply JW = J * W (n x m), parallel: (n_local x m)
+    Eigen::MatrixXd resJW_local(n_local, m_global);
+    parMatrixOps.multiply(J_local, W_local, resJW_local, vertexOffsets, n_global, n_global, m_global);
+    validate_result_equals_reference(resJW_local, JW_global, vertexOffsets.at(context.rank), true);
+
+    BOOST_TEST_MESSAGE("Test 2");
+    // 2.) multiply WZ = W * Z (n x n), parallel: (n_global x n_local)
+    Eigen::MatrixXd resWZ_local(n_global, n_local);
+    parMatrixOps.multiply(W_local, Z_local, resWZ_local, vertexOffsets, n_global, m_global, n_global);
+    validate_result_equals_reference(resWZ_local, WZ_global, vertexOffsets.at(context.rank), false);
+
+    BOOST_TEST_MESSAGE("Test 3");
+    // 3.) multiply Jres = J * res (n x 1), parallel: (n_local x 1)
+    Eigen::MatrixXd resJres_local(n_local, 1);
+    parMatrixOps.multiply(J_local, res_local, resJres_local, vertexOffsets, n_global, n_global, 1);
+    validate_result_equals_reference(resJres_local, Jres_global, vertexOffsets.at(context.rank), true);
+
+    BOOST_TEST_MESSAGE("Test 4");
+    // 4.) multiply JW = J * W (n x m), parallel: (n_local x m) with block-wise multiplication
+    Eigen::MatrixXd resJW_local2(n_local, m_global);
+    parMatrixOps.multiply(J_local, W_local, resJW_local2, vertexOffsets, n_global, n_global, m_global, false);
+    validate_result_equals_reference(resJW_local2, JW_global, vertexOffsets.at(context.rank), true);
+
+    BOOST_TEST_MESSAGE("Test 5");
+    // 5.) multiply Jres = J * res (n x 1), parallel: (n_local x 1) with block-wise multiplication
+    Eigen::VectorXd resJres_local2(n_local); // use the function with parameter of type Eigen::VectorXd
+    parMatrixOps.multiply(J_local, res_local_vec, resJres_local2, vertexOffsets, n_global, n_global, 1, false);
+    Eigen::MatrixXd matrix_cast = resJres_local2;
+    validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets.at(context.rank), true);
+  }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
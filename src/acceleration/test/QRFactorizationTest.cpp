@@ -1,4 +1,5 @@
 #include <Eigen/Core>
+#include <Eigen/QR>
 #include <math.h>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
@@ -150,4 +151,190 @@ BOOST_AUTO_TEST_CASE(testQRFactorization)
   testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
 }
 
+BOOST_AUTO_TEST_CASE(testQRFactorizationCGS2)
+{
+  PRECICE_TEST(1_rank);
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  QRFactorization qr_mgs(BaseQNAcceleration::NOFILTER);
+  QRFactorization qr_cgs2(BaseQNAcceleration::NOFILTER);
+  qr_cgs2.setOrthogonalization(QRFactorization::Orthogonalization::CGS2);
+  qr_mgs.setGlobalRows(n);
+  qr_cgs2.setGlobalRows(n);
+  for (int j = 0; j < m; j++) {
+    qr_mgs.pushBack(A.col(j));
+    qr_cgs2.pushBack(A.col(j));
+  }
+
+  BOOST_TEST(qr_cgs2.cols() == m);
+  testQTQequalsIdentity(qr_cgs2.matrixQ());
+  testQRequalsA(qr_cgs2.matrixQ(), qr_cgs2.matrixR(), A);
+  BOOST_TEST(testing::equals(qr_cgs2.matrixR(), qr_mgs.matrixR(), 1e-10));
+
+  // insert in the middle, such that the new column is rotated into place
+  Eigen::VectorXd col3 = A.col(3);
+  qr_cgs2.deleteColumn(3);
+  qr_cgs2.insertColumn(3, col3);
+  testQTQequalsIdentity(qr_cgs2.matrixQ());
+  testQRequalsA(qr_cgs2.matrixQ(), qr_cgs2.matrixR(), A);
+
+  // a linear dependent column is discarded by the QR2-filter
+  BOOST_TEST(not qr_cgs2.insertColumn(m, A.col(0) + A.col(1), 1e-8));
+  BOOST_TEST(qr_cgs2.cols() == m);
+}
+
+BOOST_AUTO_TEST_CASE(testQRFactorizationCGS2Distributed)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  int             m = 6, n = 8, localRows = 2;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+  Eigen::MatrixXd localA = A.middleRows(localRows * context.rank, localRows);
+
+  QRFactorization qr(BaseQNAcceleration::NOFILTER);
+  qr.setOrthogonalization(QRFactorization::Orthogonalization::CGS2);
+  qr.setGlobalRows(n);
+  for (int j = 0; j < m; j++) {
+    qr.pushBack(localA.col(j));
+  }
+  BOOST_TEST(qr.cols() == m);
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), localA);
+
+  // R is unique up to the signs of its rows
+  Eigen::MatrixXd R = Eigen::HouseholderQR<Eigen::MatrixXd>(A).matrixQR().topRows(m).triangularView<Eigen::Upper>();
+  for (int i = 0; i < m; i++) {
+    if (R(i, i) < 0) {
+      R.row(i) *= -1;
+    }
+  }
+  BOOST_TEST(testing::equals(qr.matrixR(), R, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(testAppendColumns)
+{
+  PRECICE_TEST(1_rank);
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  // reference: insert columns one by one
+  QRFactorization qr_ref(BaseQNAcceleration::NOFILTER);
+  qr_ref.setGlobalRows(n);
+  for (int j = 0; j < m; j++) {
+    qr_ref.pushBack(A.col(j));
+  }
+
+  // append all columns en block
+  QRFactorization qr_1(BaseQNAcceleration::NOFILTER);
+  qr_1.setGlobalRows(n);
+  BOOST_TEST(qr_1.appendColumns(A).empty());
+  BOOST_TEST(qr_1.cols() == m);
+  testQTQequalsIdentity(qr_1.matrixQ());
+  testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
+  BOOST_TEST(testing::equals(qr_1.matrixR(), qr_ref.matrixR(), 1e-10));
+
+  // append a block to an existing factorization
+  QRFactorization qr_2(BaseQNAcceleration::NOFILTER);
+  qr_2.setGlobalRows(n);
+  qr_2.pushBack(A.col(0));
+  qr_2.pushBack(A.col(1));
+  BOOST_TEST(qr_2.appendColumns(A.rightCols(m - 2)).empty());
+  testQTQequalsIdentity(qr_2.matrixQ());
+  testQRequalsA(qr_2.matrixQ(), qr_2.matrixR(), A);
+
+  // linear dependent columns are discarded by the QR2-filter
+  Eigen::MatrixXd B(n, 4);
+  B << A.col(0), A.col(1), A.col(0) - A.col(1), A.col(2);
+  QRFactorization qr_3(BaseQNAcceleration::NOFILTER);
+  qr_3.setGlobalRows(n);
+  std::vector<int> discarded = qr_3.appendColumns(B, 1e-2);
+  BOOST_TEST(discarded == std::vector<int>{2});
+  BOOST_TEST(qr_3.cols() == 3);
+  Eigen::MatrixXd B_prime(n, 3);
+  B_prime << A.col(0), A.col(1), A.col(2);
+  testQTQequalsIdentity(qr_3.matrixQ());
+  testQRequalsA(qr_3.matrixQ(), qr_3.matrixR(), B_prime);
+}
+
+BOOST_AUTO_TEST_CASE(testAppendColumnsDistributed)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  int             m = 6, n = 8, localRows = 2;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+  Eigen::MatrixXd localA = A.middleRows(localRows * context.rank, localRows);
+
+  QRFactorization qr(BaseQNAcceleration::NOFILTER);
+  qr.setGlobalRows(n);
+  BOOST_TEST(qr.appendColumns(localA).empty());
+  BOOST_TEST(qr.cols() == m);
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), localA);
+
+  // R is unique up to the signs of its rows
+  Eigen::MatrixXd R = Eigen::HouseholderQR<Eigen::MatrixXd>(A).matrixQR().topRows(m).triangularView<Eigen::Upper>();
+  for (int i = 0; i < m; i++) {
+    if (R(i, i) < 0) {
+      R.row(i) *= -1;
+    }
+  }
+  BOOST_TEST(testing::equals(qr.matrixR(), R, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(testDeleteColumns)
+{
+  PRECICE_TEST(1_rank);
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  QRFactorization qr_1(A, BaseQNAcceleration::NOFILTER);
+  QRFactorization qr_2(A, BaseQNAcceleration::NOFILTER);
+
+  qr_1.deleteColumns({4, 1, 3});
+  qr_2.deleteColumn(4);
+  qr_2.deleteColumn(3);
+  qr_2.deleteColumn(1);
+
+  Eigen::MatrixXd A_prime(n, 3);
+  A_prime << A.col(0), A.col(2), A.col(5);
+
+  BOOST_TEST(qr_1.cols() == 3);
+  testQTQequalsIdentity(qr_1.matrixQ());
+  testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A_prime);
+  BOOST_TEST(testing::equals(qr_1.matrixR(), qr_2.matrixR(), 1e-12));
+  BOOST_TEST(testing::equals(qr_1.matrixQ(), qr_2.matrixQ(), 1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -37,9 +37,8 @@ void CommunicateMesh::sendMesh(
     std::vector<double> coords(static_cast<size_t>(numberOfVertices) * dim);
     std::vector<int>    globalIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
+      const auto &vertexCoords = mesh.vertices()[i].getCoords();
+      std::copy(vertexCoords.data(), vertexCoords.data() + dim, coords.begin() + i * dim);
       globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
     }
     _communication->send(coords, rankReceiver);
@@ -107,11 +106,8 @@ void CommunicateMesh::receiveMesh(
     _communication->receive(vertexCoords, rankSender);
     _communication->receive(globalIDs, rankSender);
     for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
+      Eigen::Map<const Eigen::VectorXd> coords(vertexCoords.data() + i * dim, dim);
+      mesh::Vertex &                    v = mesh.createVertex(coords);
       PRECICE_ASSERT(v.getID() >= 0, v.getID());
       v.setGlobalIndex(globalIDs[i]);
       vertices.push_back(&v);
@@ -185,9 +181,8 @@ void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
     std::vector<double> coords(static_cast<size_t>(numberOfVertices) * dim);
     std::vector<int>    globalIDs(numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
+      const auto &vertexCoords = mesh.vertices()[i].getCoords();
+      std::copy(vertexCoords.data(), vertexCoords.data() + dim, coords.begin() + i * dim);
       globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
     }
     _communication->broadcast(coords);
@@ -254,11 +249,8 @@ void CommunicateMesh::broadcastReceiveMesh(
     _communication->broadcast(vertexCoords, rankBroadcaster);
     _communication->broadcast(globalIDs, rankBroadcaster);
     for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
+      Eigen::Map<const Eigen::VectorXd> coords(vertexCoords.data() + i * dim, dim);
+      mesh::Vertex &                    v = mesh.createVertex(coords);
       PRECICE_ASSERT(v.getID() >= 0, v.getID());
       v.setGlobalIndex(globalIDs[i]);
       vertices.push_back(&v);
@@ -160,10 +160,10 @@ public:
    * @param[in] size Total size of the participant
    *
    */
-  void connectMasterSlaves(std::string const &participantName,
-                           std::string const &tag,
-                           int                rank,
-                           int                size);
+  virtual void connectMasterSlaves(std::string const &participantName,
+                                   std::string const &tag,
+                                   int                rank,
+                                   int                size);
 
   /**
    * @brief Disconnects from communication space, i.e. participant.
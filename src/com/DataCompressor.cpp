@@ -0,0 +1,115 @@
+#include "DataCompressor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
+
+namespace precice {
+namespace com {
+
+namespace {
+/// Amount of explicitly stored mantissa bits of a double
+constexpr int mantissaBits = std::numeric_limits<double>::digits - 1;
+
+constexpr std::uint64_t exponentMask = 0x7FF0000000000000ull;
+
+/// Rounds the mantissa to nearest, such that the lowest droppedBits bits are zero.
+std::uint64_t roundMantissa(std::uint64_t bits, int droppedBits)
+{
+  if ((bits & exponentMask) == exponentMask) {
+    return bits; // Inf and NaN
+  }
+  const std::uint64_t mask    = (std::uint64_t(1) << droppedBits) - 1;
+  const std::uint64_t rounded = (bits + (mask >> 1) + 1) & ~mask;
+  // A carry may overflow the exponent of the largest values
+  return ((rounded & exponentMask) == exponentMask) ? (bits & ~mask) : rounded;
+}
+} // namespace
+
+DataCompressor::DataCompressor(
+    Mode   mode,
+    double tolerance)
+    : _mode(mode)
+{
+#ifdef PRECICE_NO_ZLIB
+  PRECICE_CHECK(_mode == Mode::None, "Compressing data requires preCICE to be compiled with \"PRECICE_ZlibCompression=ON\".");
+#endif
+  if (_mode == Mode::Lossy) {
+    PRECICE_CHECK(tolerance > 0.0 && tolerance < 1.0,
+                  "The tolerance of a lossy compression has to be in (0, 1), but is " << tolerance);
+    // Rounding to keptBits bits has a relative error of at most 2^-(keptBits + 1)
+    const int keptBits = std::max(0, static_cast<int>(std::ceil(-std::log2(tolerance))) - 1);
+    _droppedBits       = std::max(0, mantissaBits - keptBits);
+  }
+}
+
+void DataCompressor::compress(
+    const double *              values,
+    std::size_t                 size,
+    std::vector<unsigned char> &message) const
+{
+  PRECICE_ASSERT(isActive());
+#ifndef PRECICE_NO_ZLIB
+  constexpr std::size_t width = sizeof(double);
+
+  // Shuffle the bytes of all values
+  std::vector<unsigned char> shuffled(size * width);
+  for (std::size_t i = 0; i < size; ++i) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &values[i], width);
+    if (_droppedBits > 0) {
+      bits = roundMantissa(bits, _droppedBits);
+    }
+    for (std::size_t b = 0; b < width; ++b) {
+      shuffled[b * size + i] = static_cast<unsigned char>(bits >> (8 * b));
+    }
+  }
+
+  uLongf payloadSize = compressBound(shuffled.size());
+  message.resize(sizeof(Header) + payloadSize);
+  const int status = compress2(message.data() + sizeof(Header), &payloadSize,
+                               shuffled.data(), shuffled.size(), Z_BEST_SPEED);
+  PRECICE_CHECK(status == Z_OK, "Compression of " << size << " values failed (zlib error " << status << ')');
+
+  const Header header = payloadSize;
+  std::memcpy(message.data(), &header, sizeof(Header));
+  message.resize(sizeof(Header) + payloadSize);
+#endif
+}
+
+bool DataCompressor::decompress(
+    const unsigned char *payload,
+    std::size_t          bytes,
+    double *             values,
+    std::size_t          size) const
+{
+  PRECICE_ASSERT(isActive());
+#ifndef PRECICE_NO_ZLIB
+  constexpr std::size_t width = sizeof(double);
+
+  std::vector<unsigned char> shuffled(size * width);
+  uLongf                     shuffledSize = shuffled.size();
+  const int                  status       = uncompress(shuffled.data(), &shuffledSize, payload, bytes);
+  if (status != Z_OK || shuffledSize != shuffled.size()) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < size; ++i) {
+    std::uint64_t bits = 0;
+    for (std::size_t b = 0; b < width; ++b) {
+      bits |= std::uint64_t(shuffled[b * size + i]) << (8 * b);
+    }
+    std::memcpy(&values[i], &bits, width);
+  }
+#endif
+  return true;
+}
+
+} // namespace com
+} // namespace precice
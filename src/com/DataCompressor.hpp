@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief Compresses arrays of double values for the transfer over a communication.
+ *
+ * The bytes of all values are shuffled, such that the n-th bytes of all values are stored contiguously,
+ * and the result is compressed by zlib. The shuffle groups sign, exponent and leading mantissa bytes,
+ * which are similar for smooth coupling data.
+ *
+ * The lossy mode additionally rounds the mantissa of every value to the least amount of bits which
+ * keeps the relative error of the value below the tolerance. The dropped bits are zero and compress well.
+ *
+ * Without zlib (PRECICE_NO_ZLIB), only Mode::None is available.
+ */
+class DataCompressor {
+public:
+  enum class Mode {
+    /// Values are sent as they are
+    None,
+    /// Byte shuffle and zlib
+    Lossless,
+    /// Mantissa rounding, byte shuffle and zlib
+    Lossy
+  };
+
+  /// Type of the header of a compressed message, which holds the size of the payload in bytes
+  using Header = std::uint64_t;
+
+  /**
+   * @brief Constructor
+   *
+   * @param[in] mode Compression mode
+   * @param[in] tolerance Bound of the relative error of each value, only used by Mode::Lossy
+   */
+  explicit DataCompressor(Mode mode = Mode::None, double tolerance = 0.0);
+
+  /// Returns true, if values are compressed.
+  bool isActive() const
+  {
+    return _mode != Mode::None;
+  }
+
+  /**
+   * @brief Compresses the values into a message
+   *
+   * The message starts with a Header holding the size of the payload, which follows it.
+   */
+  void compress(const double *values, std::size_t size, std::vector<unsigned char> &message) const;
+
+  /**
+   * @brief Decompresses the payload of a message
+   *
+   * Does not raise errors, as it is called by the IO threads.
+   *
+   * @param[in] payload Payload of the message without Header
+   * @param[in] bytes Size of the payload in bytes
+   * @param[out] values Decompressed values
+   * @param[in] size Amount of values, has to match the amount of compressed values
+   *
+   * @returns false, if the payload is corrupt or does not hold size values
+   */
+  bool decompress(const unsigned char *payload, std::size_t bytes, double *values, std::size_t size) const;
+
+private:
+  mutable logging::Logger _log{"com::DataCompressor"};
+
+  Mode _mode;
+
+  /// Amount of mantissa bits dropped by Mode::Lossy
+  int _droppedBits = 0;
+};
+
+} // namespace com
+} // namespace precice
@@ -120,6 +120,12 @@ public:
 
   virtual void broadcast(bool &itemToReceive, int rankBroadcaster) override;
 
+  /// Returns the communicator of the master and all slaves, which can be used for further collective operations.
+  MPI_Comm &collectiveCommunicator()
+  {
+    return communicator();
+  }
+
 private:
   virtual MPI_Comm &communicator(int rank = 0) override;
 
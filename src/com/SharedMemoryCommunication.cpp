@@ -0,0 +1,895 @@
+#ifndef PRECICE_NO_SHM
+
+#include "SharedMemoryCommunication.hpp"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <csignal>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include "ConnectionInfoPublisher.hpp"
+#include "SocketRequest.hpp"
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace com {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "The shared memory communication requires address-free atomics.");
+
+namespace {
+
+/// Waits increasingly longer, while polling the shared memory
+class Backoff {
+public:
+  /// Returns true about every 10ms of sleeping, such that the caller can check on the remote process.
+  bool wait()
+  {
+    if (_yields < 100) {
+      ++_yields;
+      std::this_thread::yield();
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+    return ++_sleeps % 500 == 0;
+  }
+
+  void reset()
+  {
+    _yields = 0;
+    _sleeps = 0;
+  }
+
+private:
+  int _yields = 0;
+  int _sleeps = 0;
+};
+
+/// Queued sends are dropped when closing a connection, if the remote side has not read anything for this long.
+constexpr std::chrono::seconds closeTimeout{10};
+
+/// Start of the segment, written by the requester before it sets state to 1.
+struct Header {
+  std::atomic<int> state;
+  int              requesterRank;
+  int              requesterCommunicatorSize;
+  std::uint64_t    bufferSize;
+
+  /// Process IDs of the requester and the acceptor, the latter is 0 until the acceptor mapped the segment.
+  std::atomic<int> processIds[2];
+};
+
+/// The lobby of acceptConnectionAsServer() hands out the names of the connection segments.
+struct Lobby {
+  std::atomic<int> nextSlot;
+};
+
+constexpr std::size_t cacheLine = 64;
+
+constexpr std::size_t roundUp(std::size_t bytes)
+{
+  return (bytes + cacheLine - 1) / cacheLine * cacheLine;
+}
+
+std::string systemError()
+{
+  return std::strerror(errno);
+}
+} // namespace
+
+/// Ring buffer in shared memory, the data follows the struct
+struct SharedMemoryCommunication::Ring {
+  /// Bytes written in total, only modified by the producer
+  alignas(cacheLine) std::atomic<std::uint64_t> head;
+
+  /// Bytes read in total, only modified by the consumer
+  alignas(cacheLine) std::atomic<std::uint64_t> tail;
+
+  alignas(cacheLine) std::uint64_t capacity;
+
+  unsigned char *buffer()
+  {
+    return reinterpret_cast<unsigned char *>(this) + sizeof(Ring);
+  }
+
+  /// Copies as many bytes as fit into the ring, returns the amount of copied bytes.
+  std::size_t write(const unsigned char *data, std::size_t size)
+  {
+    const std::uint64_t written = head.load(std::memory_order_relaxed);
+    const std::uint64_t free    = capacity - (written - tail.load(std::memory_order_acquire));
+    const std::size_t   count   = std::min<std::uint64_t>(free, size);
+    const std::size_t   start   = written % capacity;
+    const std::size_t   first   = std::min<std::uint64_t>(count, capacity - start);
+    std::memcpy(buffer() + start, data, first);
+    std::memcpy(buffer(), data + first, count - first);
+    head.store(written + count, std::memory_order_release);
+    return count;
+  }
+
+  /// Copies as many bytes as available from the ring, returns the amount of copied bytes.
+  std::size_t read(unsigned char *data, std::size_t size)
+  {
+    const std::uint64_t read      = tail.load(std::memory_order_relaxed);
+    const std::uint64_t available = head.load(std::memory_order_acquire) - read;
+    const std::size_t   count     = std::min<std::uint64_t>(available, size);
+    const std::size_t   start     = read % capacity;
+    const std::size_t   first     = std::min<std::uint64_t>(count, capacity - start);
+    std::memcpy(data, buffer() + start, first);
+    std::memcpy(data + first, buffer(), count - first);
+    tail.store(read + count, std::memory_order_release);
+    return count;
+  }
+};
+
+/**
+ * @brief Mapping of a shared memory segment
+ *
+ * A connection segment consists of the Header, the ring from the requester to the acceptor and
+ * the ring from the acceptor to the requester, each starting at a cache line.
+ */
+struct SharedMemoryCommunication::Segment {
+  void *      address = nullptr;
+  std::size_t size    = 0;
+
+  ~Segment()
+  {
+    if (address) {
+      munmap(address, size);
+    }
+  }
+
+  Header &header()
+  {
+    return *static_cast<Header *>(address);
+  }
+
+  static std::size_t bytes(std::size_t bufferSize)
+  {
+    return roundUp(sizeof(Header)) + 2 * roundUp(sizeof(Ring) + bufferSize);
+  }
+
+  Ring &ring(int index)
+  {
+    const std::size_t offset = roundUp(sizeof(Header)) + index * roundUp(sizeof(Ring) + header().bufferSize);
+    return *reinterpret_cast<Ring *>(static_cast<unsigned char *>(address) + offset);
+  }
+};
+
+SharedMemoryCommunication::SharedMemoryCommunication(
+    std::string const &addressDirectory,
+    std::size_t        bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+  PRECICE_ASSERT(_bufferSize > 0);
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  PRECICE_TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(isConnected());
+  return _channels.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 std::string const &tag,
+                                                 int /*acceptorRank*/,
+                                                 int                rankOffset)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  setRankOffset(rankOffset);
+
+  // The requesters are ranks 0 to N-1, rank r creates the segment "name-r"
+  const std::string    name = newSegmentName();
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  conInfo.write(name);
+  PRECICE_DEBUG("Accept connection at " << name);
+
+  int requesterCommunicatorSize = 1;
+  for (int slot = 0; slot < requesterCommunicatorSize; ++slot) {
+    int requesterRank = -1;
+    accept(name + '-' + std::to_string(slot), &requesterRank, &requesterCommunicatorSize);
+    PRECICE_ASSERT(requesterRank == slot, requesterRank, slot);
+    PRECICE_ASSERT(requesterCommunicatorSize > 0,
+                   "Requester communicator size is " << requesterCommunicatorSize << " which is invalid.");
+  }
+  _isConnected = true;
+  startWorker();
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         std::string const &tag,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  PRECICE_ASSERT(requesterCommunicatorSize >= 0, "Requester communicator size has to be positve.");
+  PRECICE_ASSERT(not isConnected());
+
+  if (requesterCommunicatorSize == 0) {
+    PRECICE_DEBUG("Accepting no connections.");
+    _isConnected = true;
+    return;
+  }
+
+  // The requesters have arbitrary ranks, they draw the slot of their segment from the lobby
+  const std::string name = newSegmentName();
+  shm_unlink(name.c_str());
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  PRECICE_CHECK(fd >= 0 && ftruncate(fd, sizeof(Lobby)) == 0,
+                "Creating the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+  Segment lobby;
+  lobby.size    = sizeof(Lobby);
+  lobby.address = mmap(nullptr, lobby.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  PRECICE_CHECK(lobby.address != MAP_FAILED,
+                "Mapping the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+  new (lobby.address) Lobby{{0}};
+
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+  conInfo.write(name);
+  PRECICE_DEBUG("Accepting connection at " << name);
+
+  for (int slot = 0; slot < requesterCommunicatorSize; ++slot) {
+    int requesterRank = -1;
+    accept(name + '-' + std::to_string(slot), &requesterRank, nullptr);
+  }
+  shm_unlink(name.c_str());
+  _isConnected = true;
+  startWorker();
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  std::string const &tag,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  ConnectionInfoReader conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  std::string const    name = conInfo.read();
+  PRECICE_DEBUG("Request connection to " << name);
+
+  request(name + '-' + std::to_string(requesterRank), 0, requesterRank, requesterCommunicatorSize);
+  _isConnected = true;
+  startWorker();
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string const &  acceptorName,
+                                                          std::string const &  requesterName,
+                                                          std::string const &  tag,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  PRECICE_ASSERT(not isConnected());
+
+  for (auto const &acceptorRank : acceptorRanks) {
+    ConnectionInfoReader conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+    std::string const    name = conInfo.read();
+    PRECICE_DEBUG("Requesting connection to " << name << ", rank = " << acceptorRank);
+
+    // The lobby exists, before its name is published
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    PRECICE_CHECK(fd >= 0,
+                  "Opening the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+    Segment lobby;
+    lobby.size    = sizeof(Lobby);
+    lobby.address = mmap(nullptr, lobby.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    PRECICE_CHECK(lobby.address != MAP_FAILED,
+                  "Mapping the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+    const int slot = static_cast<Lobby *>(lobby.address)->nextSlot.fetch_add(1);
+
+    request(name + '-' + std::to_string(slot), acceptorRank, requesterRank, 1);
+  }
+  _isConnected = true;
+  startWorker();
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  PRECICE_TRACE();
+
+  if (not isConnected())
+    return;
+
+  // Queued sends still have to be copied into the rings, which are unmapped below. They are dropped, if the
+  // remote side stopped reading. Queued receives are dropped, as for the other communications.
+  using clock = std::chrono::steady_clock;
+  for (auto &entry : _channels) {
+    Channel &     channel      = *entry.second;
+    Backoff       backoff;
+    std::uint64_t written      = channel.sendRing->head.load(std::memory_order_relaxed);
+    auto          lastProgress = clock::now();
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(channel.sendMutex);
+        if (channel.sends.empty()) {
+          break;
+        }
+      }
+      if (not backoff.wait()) {
+        continue;
+      }
+      checkPeer(channel);
+      const std::uint64_t head = channel.sendRing->head.load(std::memory_order_relaxed);
+      if (head != written) {
+        written      = head;
+        lastProgress = clock::now();
+      } else if (clock::now() - lastProgress > closeTimeout) {
+        std::lock_guard<std::mutex> lock(channel.sendMutex);
+        PRECICE_WARN("Dropping " << channel.sends.size() << " queued sends to rank " << entry.first
+                                 << ", as the remote side did not read for " << closeTimeout.count() << " seconds.");
+        failTransfers(channel.sends, "The send was dropped when closing the shared memory connection.");
+        break;
+      }
+    }
+  }
+
+  if (_worker.joinable()) {
+    _stopWorker = true;
+    {
+      std::lock_guard<std::mutex> lock(_workMutex);
+      _hasWork = true;
+    }
+    _workCondition.notify_one();
+    _worker.join();
+  }
+  _channels.clear();
+
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::prepareEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Creating connection exchange directory " << dir);
+  try {
+    create_directories(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Creating directory for connection info failed with filesystem error: " << e.what());
+  }
+}
+
+void SharedMemoryCommunication::cleanupEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Removing connection exchange directory " << dir);
+  try {
+    remove_all(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Cleaning up connection info failed with filesystem error " << e.what());
+  }
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  Channel &    target = channel(rankReceiver);
+  const size_t size   = itemToSend.size();
+  sendBytes(target, &size, sizeof(size_t));
+  sendBytes(target, itemToSend.data(), size);
+}
+
+void SharedMemoryCommunication::send(const int *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  sendBytes(channel(rankReceiver), itemsToSend, size * sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  return aSendBytes(channel(rankReceiver), itemsToSend, size * sizeof(int));
+}
+
+void SharedMemoryCommunication::send(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  sendBytes(channel(rankReceiver), itemsToSend, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  return aSendBytes(channel(rankReceiver), itemsToSend, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aSendBytes(channel(rankReceiver), itemsToSend.data(), itemsToSend.size() * sizeof(double));
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(channel(rankReceiver), &itemToSend, sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aSendBytes(channel(rankReceiver), &itemToSend, sizeof(double));
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(channel(rankReceiver), &itemToSend, sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aSendBytes(channel(rankReceiver), &itemToSend, sizeof(int));
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(channel(rankReceiver), &itemToSend, sizeof(bool));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aSendBytes(channel(rankReceiver), &itemToSend, sizeof(bool));
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  Channel &source = channel(rankSender);
+  size_t   size   = 0;
+  receiveBytes(source, &size, sizeof(size_t));
+  std::vector<char> chars(size);
+  receiveBytes(source, chars.data(), size);
+  itemToReceive.assign(chars.begin(), chars.end());
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  receiveBytes(channel(rankSender), itemsToReceive, size * sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  receiveBytes(channel(rankSender), itemsToReceive, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive,
+                                               int     size,
+                                               int     rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  return aReceiveBytes(channel(rankSender), itemsToReceive, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aReceiveBytes(channel(rankSender), itemsToReceive.data(), itemsToReceive.size() * sizeof(double));
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(channel(rankSender), &itemToReceive, sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aReceiveBytes(channel(rankSender), &itemToReceive, sizeof(double));
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(channel(rankSender), &itemToReceive, sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aReceiveBytes(channel(rankSender), &itemToReceive, sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(channel(rankSender), &itemToReceive, sizeof(bool));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aReceiveBytes(channel(rankSender), &itemToReceive, sizeof(bool));
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  Channel &    target = channel(rankReceiver);
+  const size_t size   = v.size();
+  sendBytes(target, &size, sizeof(size_t));
+  sendBytes(target, v.data(), size * sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  Channel &source = channel(rankSender);
+  size_t   size   = 0;
+  receiveBytes(source, &size, sizeof(size_t));
+  v.resize(size);
+  receiveBytes(source, v.data(), size * sizeof(int));
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  Channel &    target = channel(rankReceiver);
+  const size_t size   = v.size();
+  sendBytes(target, &size, sizeof(size_t));
+  sendBytes(target, v.data(), size * sizeof(double));
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  Channel &source = channel(rankSender);
+  size_t   size   = 0;
+  receiveBytes(source, &size, sizeof(size_t));
+  v.resize(size);
+  receiveBytes(source, v.data(), size * sizeof(double));
+}
+
+SharedMemoryCommunication::Channel &SharedMemoryCommunication::channel(int rank)
+{
+  rank = adjustRank(rank);
+  PRECICE_ASSERT(rank >= 0, rank);
+  PRECICE_ASSERT(isConnected());
+  auto found = _channels.find(rank);
+  PRECICE_ASSERT(found != _channels.end(), "There is no connection to rank " << rank);
+  return *found->second;
+}
+
+std::string SharedMemoryCommunication::newSegmentName() const
+{
+  static std::atomic<int> counter{0};
+  return "/precice-" + std::to_string(getpid()) + '-' + std::to_string(counter++);
+}
+
+void SharedMemoryCommunication::request(std::string const &name,
+                                        int                remoteRank,
+                                        int                requesterRank,
+                                        int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(name, remoteRank, requesterRank);
+  const std::size_t bytes = Segment::bytes(_bufferSize);
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    // Left behind by a crashed run of a process with the same ID
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  }
+  PRECICE_CHECK(fd >= 0 && ftruncate(fd, bytes) == 0,
+                "Creating the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+
+  auto segment     = std::unique_ptr<Segment>(new Segment);
+  segment->size    = bytes;
+  segment->address = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  PRECICE_CHECK(segment->address != MAP_FAILED,
+                "Mapping the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+
+  Header *header                    = new (segment->address) Header;
+  header->requesterRank             = requesterRank;
+  header->requesterCommunicatorSize = requesterCommunicatorSize;
+  header->bufferSize                = _bufferSize;
+  header->processIds[0].store(getpid(), std::memory_order_relaxed);
+  header->processIds[1].store(0, std::memory_order_relaxed);
+  for (int index = 0; index < 2; ++index) {
+    Ring *ring     = new (&segment->ring(index)) Ring;
+    ring->capacity = _bufferSize;
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+  }
+  header->state.store(1, std::memory_order_release);
+
+  addChannel(remoteRank, std::move(segment), false);
+}
+
+void SharedMemoryCommunication::accept(std::string const &name,
+                                       int *              requesterRank,
+                                       int *              requesterCommunicatorSize)
+{
+  PRECICE_TRACE(name);
+
+  // Wait until the requester created the segment and set its size
+  Backoff     backoff;
+  int         fd = -1;
+  struct stat status;
+  while (true) {
+    if (fd < 0) {
+      fd = shm_open(name.c_str(), O_RDWR, 0);
+      PRECICE_CHECK(fd >= 0 || errno == ENOENT,
+                    "Opening the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+    }
+    if (fd >= 0 && fstat(fd, &status) == 0 && status.st_size > 0) {
+      break;
+    }
+    backoff.wait();
+  }
+
+  auto segment     = std::unique_ptr<Segment>(new Segment);
+  segment->size    = status.st_size;
+  segment->address = mmap(nullptr, segment->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  PRECICE_CHECK(segment->address != MAP_FAILED,
+                "Mapping the shared memory segment \"" << name << "\" failed with the system error: " << systemError());
+
+  Header &header = segment->header();
+  backoff.reset();
+  while (header.state.load(std::memory_order_acquire) != 1) {
+    backoff.wait();
+  }
+  header.processIds[1].store(getpid(), std::memory_order_relaxed);
+  // Both sides mapped the segment, it is removed once both unmapped it
+  shm_unlink(name.c_str());
+
+  PRECICE_DEBUG("Accepted connection at " << name << " from rank " << header.requesterRank);
+  *requesterRank = header.requesterRank;
+  if (requesterCommunicatorSize) {
+    *requesterCommunicatorSize = header.requesterCommunicatorSize;
+  }
+  PRECICE_ASSERT(_channels.count(header.requesterRank) == 0,
+                 "Rank " << header.requesterRank << " has already been connected. Duplicate requests are not allowed.");
+  addChannel(header.requesterRank, std::move(segment), true);
+}
+
+void SharedMemoryCommunication::addChannel(int remoteRank, std::unique_ptr<Segment> segment, bool isAcceptor)
+{
+  auto channel         = std::unique_ptr<Channel>(new Channel);
+  channel->sendRing    = &segment->ring(isAcceptor ? 1 : 0);
+  channel->receiveRing = &segment->ring(isAcceptor ? 0 : 1);
+  channel->isAcceptor  = isAcceptor;
+  channel->segment     = std::move(segment);
+  _channels[remoteRank] = std::move(channel);
+}
+
+std::string SharedMemoryCommunication::peerFailure(Channel &channel) const
+{
+  // Unlike a socket, the rings do not notice when the other side is gone
+  const int processId = channel.segment->header().processIds[channel.isAcceptor ? 0 : 1].load(std::memory_order_relaxed);
+  if (processId == 0 || kill(processId, 0) == 0 || errno != ESRCH) {
+    return "";
+  }
+  return "The remote process " + std::to_string(processId) + " of a shared memory connection does not exist anymore. " +
+         "Please check the other participant for errors.";
+}
+
+void SharedMemoryCommunication::checkPeer(Channel &channel)
+{
+  const std::string failure = peerFailure(channel);
+  PRECICE_CHECK(failure.empty(), failure);
+}
+
+void SharedMemoryCommunication::failTransfers(std::deque<Transfer> &queue, std::string const &error)
+{
+  for (auto &transfer : queue) {
+    std::static_pointer_cast<SocketRequest>(transfer.request)->complete(error);
+  }
+  queue.clear();
+}
+
+void SharedMemoryCommunication::startWorker()
+{
+  _stopWorker = false;
+  _hasWork    = false;
+  _worker     = std::thread([this] { runWorker(); });
+}
+
+void SharedMemoryCommunication::runWorker()
+{
+  // Progresses the first transfers of the queue, returns true if any bytes were transferred
+  auto progress = [](std::deque<Transfer> &queue, Ring &ring, bool isSend) {
+    bool progressed = false;
+    while (not queue.empty()) {
+      Transfer &        transfer = queue.front();
+      const std::size_t count    = isSend ? ring.write(transfer.data + transfer.done, transfer.size - transfer.done)
+                                       : ring.read(transfer.data + transfer.done, transfer.size - transfer.done);
+      transfer.done += count;
+      progressed |= count > 0;
+      if (transfer.done < transfer.size) {
+        break;
+      }
+      std::static_pointer_cast<SocketRequest>(transfer.request)->complete();
+      queue.pop_front();
+    }
+    return progressed;
+  };
+
+  Backoff backoff;
+  bool    check = false;
+  while (not _stopWorker) {
+    bool pending    = false;
+    bool progressed = false;
+    for (auto &entry : _channels) {
+      Channel &channel        = *entry.second;
+      bool     channelPending = false;
+      {
+        std::unique_lock<std::mutex> lock(channel.sendMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+          progressed |= progress(channel.sends, *channel.sendRing, true);
+          channelPending |= not channel.sends.empty();
+        } else {
+          pending = true;
+        }
+      }
+      {
+        std::unique_lock<std::mutex> lock(channel.receiveMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+          progressed |= progress(channel.receives, *channel.receiveRing, false);
+          channelPending |= not channel.receives.empty();
+        } else {
+          pending = true;
+        }
+      }
+      // Remote processes of finished connections may have exited already. Errors are raised by the threads
+      // testing or waiting for the failed requests, not by the worker.
+      if (check && channelPending) {
+        const std::string failure = peerFailure(channel);
+        if (not failure.empty()) {
+          std::lock_guard<std::mutex> sendLock(channel.sendMutex);
+          std::lock_guard<std::mutex> receiveLock(channel.receiveMutex);
+          failTransfers(channel.sends, failure);
+          failTransfers(channel.receives, failure);
+          channelPending = false;
+        }
+      }
+      pending |= channelPending;
+    }
+    check = false;
+
+    if (not pending) {
+      std::unique_lock<std::mutex> lock(_workMutex);
+      _workCondition.wait(lock, [this] { return _hasWork; });
+      _hasWork = false;
+      backoff.reset();
+    } else if (progressed) {
+      backoff.reset();
+    } else {
+      // Only check on the remote processes while waiting for them
+      check = backoff.wait();
+    }
+  }
+}
+
+void SharedMemoryCommunication::sendBytes(Channel &channel, const void *data, std::size_t size)
+{
+  PtrRequest request;
+  {
+    std::lock_guard<std::mutex> lock(channel.sendMutex);
+    auto                        bytes = static_cast<const unsigned char *>(data);
+    if (channel.sends.empty()) {
+      Backoff     backoff;
+      std::size_t done = 0;
+      while (done < size) {
+        const std::size_t count = channel.sendRing->write(bytes + done, size - done);
+        done += count;
+        if (count > 0) {
+          backoff.reset();
+        } else if (backoff.wait()) {
+          checkPeer(channel);
+        }
+      }
+      return;
+    }
+    // Earlier asynchronous sends have to be completed first
+    request = enqueue(channel.sends, const_cast<unsigned char *>(bytes), size, 0);
+  }
+  request->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSendBytes(Channel &channel, const void *data, std::size_t size)
+{
+  std::lock_guard<std::mutex> lock(channel.sendMutex);
+  auto                        bytes = const_cast<unsigned char *>(static_cast<const unsigned char *>(data));
+  std::size_t                 done  = 0;
+  if (channel.sends.empty()) {
+    done = channel.sendRing->write(bytes, size);
+  }
+  return enqueue(channel.sends, bytes, size, done);
+}
+
+void SharedMemoryCommunication::receiveBytes(Channel &channel, void *data, std::size_t size)
+{
+  PtrRequest request;
+  {
+    std::lock_guard<std::mutex> lock(channel.receiveMutex);
+    auto                        bytes = static_cast<unsigned char *>(data);
+    if (channel.receives.empty()) {
+      Backoff     backoff;
+      std::size_t done = 0;
+      while (done < size) {
+        const std::size_t count = channel.receiveRing->read(bytes + done, size - done);
+        done += count;
+        if (count > 0) {
+          backoff.reset();
+        } else if (backoff.wait()) {
+          checkPeer(channel);
+        }
+      }
+      return;
+    }
+    // Earlier asynchronous receives have to be completed first
+    request = enqueue(channel.receives, bytes, size, 0);
+  }
+  request->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aReceiveBytes(Channel &channel, void *data, std::size_t size)
+{
+  std::lock_guard<std::mutex> lock(channel.receiveMutex);
+  auto                        bytes = static_cast<unsigned char *>(data);
+  std::size_t                 done  = 0;
+  if (channel.receives.empty()) {
+    done = channel.receiveRing->read(bytes, size);
+  }
+  return enqueue(channel.receives, bytes, size, done);
+}
+
+PtrRequest SharedMemoryCommunication::enqueue(std::deque<Transfer> &queue, unsigned char *data, std::size_t size, std::size_t done)
+{
+  auto request = std::make_shared<SocketRequest>();
+  if (done == size) {
+    request->complete();
+    return request;
+  }
+  queue.push_back(Transfer{data, size, done, request});
+  {
+    std::lock_guard<std::mutex> lock(_workMutex);
+    _hasWork = true;
+  }
+  _workCondition.notify_one();
+  return request;
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHM
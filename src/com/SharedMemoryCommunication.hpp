@@ -0,0 +1,259 @@
+#ifndef PRECICE_NO_SHM
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stddef.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "com/Communication.hpp"
+#include "com/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief Implements Communication by using POSIX shared memory, for participants running on the same node.
+ *
+ * Every connection is a shared memory segment, which holds one lock-free single-producer/single-consumer
+ * ring buffer per direction. The segment of a connection is created by the requester. Its name is derived
+ * from the name the acceptor publishes using the ConnectionInfoWriter. The name is removed as soon as
+ * both sides mapped the segment, such that no segments are left behind, even if a participant crashes later.
+ *
+ * Blocking sends and receives copy directly into and out of the rings. Asynchronous transfers, which cannot
+ * be completed immediately, are queued per connection and progressed by a worker thread, which keeps the
+ * order of all transfers of a connection. While waiting, the process IDs stored in the segment are used to
+ * detect a crashed remote process. The worker fails the queued transfers of such a connection, the error is
+ * raised by waiting for their requests. Closing a connection completes all queued sends first, unless the
+ * remote side stops reading.
+ */
+class SharedMemoryCommunication : public Communication {
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] addressDirectory Directory where the connection info is exchanged
+   * @param[in] bufferSize Capacity of each ring buffer in bytes
+   */
+  explicit SharedMemoryCommunication(std::string const &addressDirectory = ".",
+                                     std::size_t        bufferSize       = 1 << 20);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                std::string const &tag,
+                                int                acceptorRank,
+                                int                rankOffset = 0) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        std::string const &tag,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 std::string const &tag,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string const &  acceptorName,
+                                         std::string const &  requesterName,
+                                         std::string const &  tag,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  virtual void prepareEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  virtual void cleanupEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, int rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const &itemsToSend, int rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, int rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, int rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, int rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, int rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(int *itemsToReceive, int size, int rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(double *itemsToReceive, int size, int rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> &itemsToReceive, int rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, int rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, int rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, int rankSender) override;
+
+  void send(std::vector<int> const &v, int rankReceiver) override;
+  void receive(std::vector<int> &v, int rankSender) override;
+  void send(std::vector<double> const &v, int rankReceiver) override;
+  void receive(std::vector<double> &v, int rankSender) override;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Directory where the name of the shared memory segments is exchanged by file.
+  std::string _addressDirectory;
+
+  /// Capacity of each ring buffer in bytes
+  std::size_t _bufferSize;
+
+  /// Shared memory segment of a connection, see SharedMemoryCommunication.cpp for its layout
+  struct Segment;
+
+  /// Ring buffer in shared memory, written by one process and read by the other one.
+  struct Ring;
+
+  /// A queued asynchronous send or receive
+  struct Transfer {
+    unsigned char *data;
+    std::size_t    size;
+    std::size_t    done;
+    PtrRequest     request;
+  };
+
+  /// Process local state of a connection
+  struct Channel {
+    std::unique_ptr<Segment> segment;
+
+    Ring *sendRing    = nullptr;
+    Ring *receiveRing = nullptr;
+
+    /// The acceptor of the connection is the second process of the segment.
+    bool isAcceptor = false;
+
+    /// Guard the ring and queue of the respective direction.
+    std::mutex sendMutex;
+    std::mutex receiveMutex;
+
+    std::deque<Transfer> sends;
+    std::deque<Transfer> receives;
+  };
+
+  /// Remote rank -> connection
+  std::map<int, std::unique_ptr<Channel>> _channels;
+
+  /// Progresses queued transfers of all channels.
+  std::thread _worker;
+
+  std::mutex              _workMutex;
+  std::condition_variable _workCondition;
+  bool                    _hasWork = false;
+  std::atomic<bool>       _stopWorker{false};
+
+  /// Returns the channel to the given remote rank, after applying the rank offset.
+  Channel &channel(int rank);
+
+  /// Returns a unique name for the shared memory segments of a connection
+  std::string newSegmentName() const;
+
+  /// Creates the segment of a connection to the remote rank.
+  void request(std::string const &name, int remoteRank, int requesterRank, int requesterCommunicatorSize);
+
+  /// Waits for the segment of a connection created by a requester and attaches to it.
+  void accept(std::string const &name, int *requesterRank, int *requesterCommunicatorSize);
+
+  /// Adds the connection to _channels, the acceptor sends on the second ring.
+  void addChannel(int remoteRank, std::unique_ptr<Segment> segment, bool isAcceptor);
+
+  /// Returns the error message, if the remote process of the channel does not exist anymore, and an empty string otherwise.
+  std::string peerFailure(Channel &channel) const;
+
+  /// Raises an error if the remote process of the channel does not exist anymore.
+  void checkPeer(Channel &channel);
+
+  /// Completes the requests of all queued transfers with the error and clears the queue.
+  void failTransfers(std::deque<Transfer> &queue, std::string const &error);
+
+  void startWorker();
+
+  void runWorker();
+
+  /// Copies all bytes into the ring, waits as long as the ring is full.
+  void sendBytes(Channel &channel, const void *data, std::size_t size);
+
+  /// Copies as many bytes as possible into the ring, queues the rest.
+  PtrRequest aSendBytes(Channel &channel, const void *data, std::size_t size);
+
+  /// Copies all bytes from the ring, waits as long as the ring is empty.
+  void receiveBytes(Channel &channel, void *data, std::size_t size);
+
+  /// Copies as many bytes as possible from the ring, queues the rest.
+  PtrRequest aReceiveBytes(Channel &channel, void *data, std::size_t size);
+
+  /// Queues the remaining transfer and wakes the worker up.
+  PtrRequest enqueue(std::deque<Transfer> &queue, unsigned char *data, std::size_t size, std::size_t done);
+};
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHM
@@ -0,0 +1,28 @@
+#ifndef PRECICE_NO_SHM
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "CommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+class SharedMemoryCommunicationFactory : public CommunicationFactory {
+public:
+  explicit SharedMemoryCommunicationFactory(std::string const &addressDirectory = ".",
+                                            std::size_t        bufferSize       = 1 << 20);
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  std::string _addressDirectory;
+  std::size_t _bufferSize;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHM
@@ -3,12 +3,16 @@
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
+#include <functional>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
 #include "ConnectionInfoPublisher.hpp"
+#include "Request.hpp"
+#include "SocketIOService.hpp"
 #include "SocketRequest.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/Event.hpp"
 #include "utils/assertion.hpp"
 #include "utils/networking.hpp"
 
@@ -17,15 +21,28 @@ namespace com {
 
 namespace asio = boost::asio;
 
-SocketCommunication::SocketCommunication(unsigned short     portNumber,
-                                         bool               reuseAddress,
-                                         std::string const &networkName,
-                                         std::string const &addressDirectory)
+using precice::utils::Event;
+
+namespace {
+/// Completes the request of an asynchronous receive, a failed read is raised by the thread waiting for the request.
+void completeReceive(PtrRequest const &request, boost::system::error_code const &error)
+{
+  std::static_pointer_cast<SocketRequest>(request)->complete(
+      error ? "Receive using sockets failed with system error: " + error.message() : "");
+}
+} // namespace
+
+SocketCommunication::SocketCommunication(unsigned short        portNumber,
+                                         bool                  reuseAddress,
+                                         std::string const &   networkName,
+                                         std::string const &   addressDirectory,
+                                         DataCompressor const &compressor)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
       _addressDirectory(addressDirectory),
-      _ioService(new IOService)
+      _compressor(std::make_shared<DataCompressor>(compressor)),
+      _ioService(SocketIOService::instance().ioService())
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -126,10 +143,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
     PRECICE_ERROR("Accepting a socket connection at " << address << " failed with the system error: " << e.what());
   }
 
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this] { _ioService->run(); });
+  startIOThreads();
 }
 
 void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorName,
@@ -190,9 +204,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
     PRECICE_ERROR("Accepting a socket connection at " << address << " failed with the system error: " << e.what());
   }
 
-  // NOTE: Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this] { _ioService->run(); });
+  startIOThreads();
 }
 
 void SocketCommunication::requestConnection(std::string const &acceptorName,
@@ -249,9 +261,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
     PRECICE_ERROR("Requesting a socket connection at " << address << " failed with the system error: " << e.what());
   }
 
-  // NOTE: Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this] { _ioService->run(); });
+  startIOThreads();
 }
 
 void SocketCommunication::requestConnectionAsClient(std::string const &  acceptorName,
@@ -306,9 +316,44 @@ void SocketCommunication::requestConnectionAsClient(std::string const &  accepto
       PRECICE_ERROR("Requesting a socket connection at " << address << " failed with the system error: " << e.what());
     }
   }
-  // NOTE: Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this] { _ioService->run(); });
+  startIOThreads();
+}
+
+void SocketCommunication::connectMasterSlaves(std::string const &participantName,
+                                              std::string const &tag,
+                                              int                rank,
+                                              int                size)
+{
+  PRECICE_TRACE(participantName, rank, size);
+  Communication::connectMasterSlaves(participantName, tag, rank, size);
+  if (size == 1) {
+    return;
+  }
+
+  // In the binomial tree, rank r is the parent of all ranks r + 2^k with 2^k smaller than the lowest set bit of r.
+  // This gives every rank at most log2(size) children and a depth of log2(size).
+  const int lowestBit = rank & -rank;
+  for (int offset = 1; (rank == 0 || offset < lowestBit) && rank + offset < size; offset *= 2) {
+    _treeChildRanks.push_back(rank + offset);
+  }
+
+  // Children connect to an ephemeral port, as several ranks may share a host.
+  // Every parent publishes its address in its own directory, which it removes once all its children are connected.
+  const auto  parentName = [&participantName](int parentRank) { return participantName + "TreeParent" + std::to_string(parentRank); };
+  std::string childName  = participantName + "TreeChild";
+  if (not _treeChildRanks.empty()) {
+    PRECICE_DEBUG("Connecting to " << _treeChildRanks.size() << " children in the collective tree");
+    _treeChildren.reset(new SocketCommunication(0, false, _networkName, _addressDirectory));
+    _treeChildren->prepareEstablishment(parentName(rank), childName);
+    _treeChildren->acceptConnectionAsServer(parentName(rank), childName, tag, rank, _treeChildRanks.size());
+    _treeChildren->cleanupEstablishment(parentName(rank), childName);
+  }
+  if (rank != 0) {
+    _treeParentRank = rank - lowestBit;
+    PRECICE_DEBUG("Connecting to parent " << _treeParentRank << " in the collective tree");
+    _treeParent.reset(new SocketCommunication(0, false, _networkName, _addressDirectory));
+    _treeParent->requestConnectionAsClient(parentName(_treeParentRank), childName, tag, {_treeParentRank}, rank);
+  }
 }
 
 void SocketCommunication::closeConnection()
@@ -318,11 +363,9 @@ void SocketCommunication::closeConnection()
   if (not isConnected())
     return;
 
-  if (_thread.joinable()) {
-    _work.reset();
-    _ioService->stop();
-    _thread.join();
-  }
+  _treeParent.reset();
+  _treeChildren.reset();
+  _treeChildRanks.clear();
 
   for (auto &socket : _sockets) {
     PRECICE_ASSERT(socket.second->is_open());
@@ -335,9 +378,260 @@ void SocketCommunication::closeConnection()
     socket.second->close();
   }
 
+  // The handlers of pending operations are aborted and run by the IO threads before release returns.
+  if (_usesIOThreads) {
+    SocketIOService::instance().release();
+    _usesIOThreads = false;
+  }
+  _queues.clear();
+  _receiveQueues.clear();
+  _strands.clear();
+
   _isConnected = false;
 }
 
+std::shared_ptr<SocketSendQueue::Strand> SocketCommunication::strand(int rank)
+{
+  auto &strand = _strands[rank];
+  if (not strand) {
+    strand = std::make_shared<SocketSendQueue::Strand>(*_ioService);
+  }
+  return strand;
+}
+
+SocketSendQueue &SocketCommunication::queue(int rankReceiver)
+{
+  auto &queue = _queues[rankReceiver];
+  if (not queue) {
+    queue = std::make_shared<SocketSendQueue>(_sockets[rankReceiver], strand(rankReceiver));
+  }
+  return *queue;
+}
+
+SocketReceiveQueue &SocketCommunication::receiveQueue(int rankSender)
+{
+  auto &queue = _receiveQueues[rankSender];
+  if (not queue) {
+    queue = std::make_shared<SocketReceiveQueue>(_sockets[rankSender], strand(rankSender));
+  }
+  return *queue;
+}
+
+void SocketCommunication::startIOThreads()
+{
+  // NOTE:
+  // Keep IO threads running so that they fire asynchronous handlers.
+  if (not _usesIOThreads) {
+    SocketIOService::instance().acquire();
+    _usesIOThreads = true;
+  }
+}
+
+bool SocketCommunication::hasTree() const
+{
+  return _treeParent || _treeChildren;
+}
+
+template <typename T>
+void SocketCommunication::treeReduceSum(T const *itemsToSend, T *itemsToReceive, int size)
+{
+  std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
+
+  // Receiving in ascending order receives from the smallest subtrees first
+  std::vector<T> received(size);
+  for (int child : _treeChildRanks) {
+    _treeChildren->receive(received.data(), size, child);
+    for (int i = 0; i < size; i++) {
+      itemsToReceive[i] += received[i];
+    }
+  }
+
+  if (_treeParent) {
+    _treeParent->send(itemsToReceive, size, _treeParentRank);
+  }
+}
+
+template <typename T>
+void SocketCommunication::treeBroadcastSend(T const *itemsToSend, int size)
+{
+  // Sending in descending order sends to the largest subtrees first
+  std::vector<PtrRequest> requests;
+  for (auto child = _treeChildRanks.rbegin(); child != _treeChildRanks.rend(); ++child) {
+    requests.push_back(_treeChildren->aSend(itemsToSend, size, *child));
+  }
+  Request::wait(requests);
+}
+
+template <typename T>
+void SocketCommunication::treeBroadcastReceive(T *itemsToReceive, int size)
+{
+  PRECICE_ASSERT(_treeParent);
+  _treeParent->receive(itemsToReceive, size, _treeParentRank);
+  treeBroadcastSend(itemsToReceive, size);
+}
+
+void SocketCommunication::reduceSum(double const *itemsToSend, double *itemsToReceive, int size, int rankMaster)
+{
+  if (not hasTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
+  PRECICE_TRACE(size);
+  PRECICE_ASSERT(rankMaster == 0, rankMaster);
+  std::vector<double> partialSum(size);
+  treeReduceSum(itemsToSend, partialSum.data(), size);
+}
+
+void SocketCommunication::reduceSum(double const *itemsToSend, double *itemsToReceive, int size)
+{
+  if (not hasTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+  PRECICE_TRACE(size);
+  treeReduceSum(itemsToSend, itemsToReceive, size);
+}
+
+void SocketCommunication::reduceSum(int itemToSend, int &itemToReceive, int rankMaster)
+{
+  if (not hasTree()) {
+    Communication::reduceSum(itemToSend, itemToReceive, rankMaster);
+    return;
+  }
+  PRECICE_TRACE();
+  PRECICE_ASSERT(rankMaster == 0, rankMaster);
+  int partialSum = 0;
+  treeReduceSum(&itemToSend, &partialSum, 1);
+}
+
+void SocketCommunication::reduceSum(int itemToSend, int &itemToReceive)
+{
+  if (not hasTree()) {
+    Communication::reduceSum(itemToSend, itemToReceive);
+    return;
+  }
+  PRECICE_TRACE();
+  treeReduceSum(&itemToSend, &itemToReceive, 1);
+}
+
+void SocketCommunication::allreduceSum(double const *itemsToSend, double *itemsToReceive, int size, int rankMaster)
+{
+  if (not hasTree()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
+  PRECICE_TRACE(size);
+  PRECICE_ASSERT(rankMaster == 0, rankMaster);
+  treeReduceSum(itemsToSend, itemsToReceive, size);
+  treeBroadcastReceive(itemsToReceive, size);
+}
+
+void SocketCommunication::allreduceSum(double const *itemsToSend, double *itemsToReceive, int size)
+{
+  if (not hasTree()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+  PRECICE_TRACE(size);
+  treeReduceSum(itemsToSend, itemsToReceive, size);
+  treeBroadcastSend(itemsToReceive, size);
+}
+
+void SocketCommunication::allreduceSum(double itemToSend, double &itemToReceive, int rankMaster)
+{
+  allreduceSum(&itemToSend, &itemToReceive, 1, rankMaster);
+}
+
+void SocketCommunication::allreduceSum(double itemToSend, double &itemToReceive)
+{
+  allreduceSum(&itemToSend, &itemToReceive, 1);
+}
+
+void SocketCommunication::allreduceSum(int itemToSend, int &itemToReceive, int rankMaster)
+{
+  if (not hasTree()) {
+    Communication::allreduceSum(itemToSend, itemToReceive, rankMaster);
+    return;
+  }
+  PRECICE_TRACE();
+  PRECICE_ASSERT(rankMaster == 0, rankMaster);
+  treeReduceSum(&itemToSend, &itemToReceive, 1);
+  treeBroadcastReceive(&itemToReceive, 1);
+}
+
+void SocketCommunication::allreduceSum(int itemToSend, int &itemToReceive)
+{
+  if (not hasTree()) {
+    Communication::allreduceSum(itemToSend, itemToReceive);
+    return;
+  }
+  PRECICE_TRACE();
+  treeReduceSum(&itemToSend, &itemToReceive, 1);
+  treeBroadcastSend(&itemToReceive, 1);
+}
+
+void SocketCommunication::broadcast(const int *itemsToSend, int size)
+{
+  if (not hasTree()) {
+    Communication::broadcast(itemsToSend, size);
+    return;
+  }
+  PRECICE_TRACE(size);
+  treeBroadcastSend(itemsToSend, size);
+}
+
+void SocketCommunication::broadcast(int *itemsToReceive, int size, int rankBroadcaster)
+{
+  if (not hasTree()) {
+    Communication::broadcast(itemsToReceive, size, rankBroadcaster);
+    return;
+  }
+  PRECICE_TRACE(size);
+  PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+  treeBroadcastReceive(itemsToReceive, size);
+}
+
+void SocketCommunication::broadcast(int itemToSend)
+{
+  broadcast(&itemToSend, 1);
+}
+
+void SocketCommunication::broadcast(int &itemToReceive, int rankBroadcaster)
+{
+  broadcast(&itemToReceive, 1, rankBroadcaster);
+}
+
+void SocketCommunication::broadcast(const double *itemsToSend, int size)
+{
+  if (not hasTree()) {
+    Communication::broadcast(itemsToSend, size);
+    return;
+  }
+  PRECICE_TRACE(size);
+  treeBroadcastSend(itemsToSend, size);
+}
+
+void SocketCommunication::broadcast(double *itemsToReceive, int size, int rankBroadcaster)
+{
+  if (not hasTree()) {
+    Communication::broadcast(itemsToReceive, size, rankBroadcaster);
+    return;
+  }
+  PRECICE_TRACE(size);
+  PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+  treeBroadcastReceive(itemsToReceive, size);
+}
+
+void SocketCommunication::broadcast(double itemToSend)
+{
+  broadcast(&itemToSend, 1);
+}
+
+void SocketCommunication::broadcast(double &itemToReceive, int rankBroadcaster)
+{
+  broadcast(&itemToReceive, 1, rankBroadcaster);
+}
+
 void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 {
   PRECICE_TRACE(itemToSend, rankReceiver);
@@ -409,11 +703,10 @@ PtrRequest SocketCommunication::aSend(const int *itemsToSend, int size, int rank
 
   PtrRequest request(new SocketRequest);
 
-  _queue.dispatch(_sockets[rankReceiver],
-                  asio::buffer(itemsToSend, size * sizeof(int)),
-                  [request] {
-                    std::static_pointer_cast<SocketRequest>(request)->complete();
-                  });
+  queue(rankReceiver).dispatch(asio::buffer(itemsToSend, size * sizeof(int)),
+                               [request] {
+                                 std::static_pointer_cast<SocketRequest>(request)->complete();
+                               });
   return request;
 }
 
@@ -437,6 +730,10 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
 {
   PRECICE_TRACE(size, rankReceiver);
 
+  if (_compressor->isActive()) {
+    return aSendCompressed(itemsToSend, size, rankReceiver);
+  }
+
   rankReceiver = adjustRank(rankReceiver);
 
   PRECICE_ASSERT(rankReceiver >= 0, rankReceiver);
@@ -444,11 +741,10 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
 
   PtrRequest request(new SocketRequest);
 
-  _queue.dispatch(_sockets[rankReceiver],
-                  asio::buffer(itemsToSend, size * sizeof(double)),
-                  [request] {
-                    std::static_pointer_cast<SocketRequest>(request)->complete();
-                  });
+  queue(rankReceiver).dispatch(asio::buffer(itemsToSend, size * sizeof(double)),
+                               [request] {
+                                 std::static_pointer_cast<SocketRequest>(request)->complete();
+                               });
   return request;
 }
 
@@ -456,6 +752,10 @@ PtrRequest SocketCommunication::aSend(std::vector<double> const &itemsToSend, in
 {
   PRECICE_TRACE(rankReceiver);
 
+  if (_compressor->isActive()) {
+    return aSendCompressed(itemsToSend.data(), itemsToSend.size(), rankReceiver);
+  }
+
   rankReceiver = adjustRank(rankReceiver);
 
   PRECICE_ASSERT(rankReceiver >= 0, rankReceiver);
@@ -463,11 +763,10 @@ PtrRequest SocketCommunication::aSend(std::vector<double> const &itemsToSend, in
 
   PtrRequest request(new SocketRequest);
 
-  _queue.dispatch(_sockets[rankReceiver],
-                  asio::buffer(itemsToSend),
-                  [request] {
-                    std::static_pointer_cast<SocketRequest>(request)->complete();
-                  });
+  queue(rankReceiver).dispatch(asio::buffer(itemsToSend),
+                               [request] {
+                                 std::static_pointer_cast<SocketRequest>(request)->complete();
+                               });
   return request;
 }
 
@@ -540,11 +839,10 @@ PtrRequest SocketCommunication::aSend(const bool &itemToSend, int rankReceiver)
 
   PtrRequest request(new SocketRequest);
 
-  _queue.dispatch(_sockets[rankReceiver],
-                  asio::buffer(&itemToSend, sizeof(bool)),
-                  [request] {
-                    std::static_pointer_cast<SocketRequest>(request)->complete();
-                  });
+  queue(rankReceiver).dispatch(asio::buffer(&itemToSend, sizeof(bool)),
+                               [request] {
+                                 std::static_pointer_cast<SocketRequest>(request)->complete();
+                               });
   return request;
 }
 
@@ -607,48 +905,32 @@ PtrRequest SocketCommunication::aReceive(double *itemsToReceive,
 {
   PRECICE_TRACE(size, rankSender);
 
+  if (_compressor->isActive()) {
+    return aReceiveCompressed(itemsToReceive, size, rankSender);
+  }
+
   rankSender = adjustRank(rankSender);
 
   PRECICE_ASSERT(rankSender >= 0, rankSender);
   PRECICE_ASSERT(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(itemsToReceive, size * sizeof(double)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
-  } catch (std::exception &e) {
-    PRECICE_ERROR("Receive using sockets failed with system error: " << e.what());
-  }
-
-  return request;
+  return aReceiveBuffer(asio::buffer(itemsToReceive, size * sizeof(double)), rankSender);
 }
 
 PtrRequest SocketCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
 {
   PRECICE_TRACE(rankSender);
 
+  if (_compressor->isActive()) {
+    return aReceiveCompressed(itemsToReceive.data(), itemsToReceive.size(), rankSender);
+  }
+
   rankSender = adjustRank(rankSender);
 
   PRECICE_ASSERT(rankSender >= 0, rankSender);
   PRECICE_ASSERT(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(itemsToReceive),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
-  } catch (std::exception &e) {
-    PRECICE_ERROR("Receive using sockets failed with system error: " << e.what());
-  }
-
-  return request;
+  return aReceiveBuffer(asio::buffer(itemsToReceive), rankSender);
 }
 
 void SocketCommunication::receive(double &itemToReceive, int rankSender)
@@ -698,19 +980,7 @@ PtrRequest SocketCommunication::aReceive(int &itemToReceive, int rankSender)
                  rankSender, _sockets.size());
   PRECICE_ASSERT(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(&itemToReceive, sizeof(int)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
-  } catch (std::exception &e) {
-    PRECICE_ERROR("Receive using sockets failed with system error: " << e.what());
-  }
-
-  return request;
+  return aReceiveBuffer(asio::buffer(&itemToReceive, sizeof(int)), rankSender);
 }
 
 void SocketCommunication::receive(bool &itemToReceive, int rankSender)
@@ -738,19 +1008,7 @@ PtrRequest SocketCommunication::aReceive(bool &itemToReceive, int rankSender)
   PRECICE_ASSERT(rankSender >= 0, rankSender);
   PRECICE_ASSERT(isConnected());
 
-  PtrRequest request(new SocketRequest);
-
-  try {
-    asio::async_read(*_sockets[rankSender],
-                     asio::buffer(&itemToReceive, sizeof(bool)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
-  } catch (std::exception &e) {
-    PRECICE_ERROR("Receive using sockets failed with system error: " << e.what());
-  }
-
-  return request;
+  return aReceiveBuffer(asio::buffer(&itemToReceive, sizeof(bool)), rankSender);
 }
 
 void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
@@ -829,6 +1087,92 @@ void SocketCommunication::receive(std::vector<double> &v, int rankSender)
   }
 }
 
+PtrRequest SocketCommunication::aSendCompressed(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+
+  rankReceiver = adjustRank(rankReceiver);
+
+  PRECICE_ASSERT(rankReceiver >= 0, rankReceiver);
+  PRECICE_ASSERT(isConnected());
+
+  auto message = std::make_shared<std::vector<unsigned char>>();
+  {
+    Event e("com.compressData");
+    _compressor->compress(itemsToSend, size, *message);
+    e.addData("UncompressedBytes", size * sizeof(double));
+    e.addData("CompressedBytes", message->size());
+  }
+
+  PtrRequest                        request(new SocketRequest);
+  const std::vector<unsigned char> &bytes = *message;
+
+  queue(rankReceiver).dispatch(asio::buffer(bytes),
+                               [request, message] {
+                                 std::static_pointer_cast<SocketRequest>(request)->complete();
+                               });
+  return request;
+}
+
+PtrRequest SocketCommunication::aReceiveBuffer(asio::mutable_buffers_1 buffer, int rankSender)
+{
+  PtrRequest request(new SocketRequest);
+  receiveQueue(rankSender).dispatch([request, buffer](Socket &socket, SocketReceiveQueue::Strand &strand, std::function<void()> done) {
+    asio::async_read(socket, buffer, strand.wrap([request, done](boost::system::error_code const &error, std::size_t) {
+                       completeReceive(request, error);
+                       done();
+                     }));
+  });
+  return request;
+}
+
+PtrRequest SocketCommunication::aReceiveCompressed(double *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+
+  rankSender = adjustRank(rankSender);
+
+  PRECICE_ASSERT(rankSender >= 0, rankSender);
+  PRECICE_ASSERT(isConnected());
+
+  PtrRequest request(new SocketRequest);
+
+  // The header holds the size of the payload, which is read and decompressed by the IO thread.
+  // The handlers must not access this communication, as they may run after it was closed.
+  // The socket is kept alive by done, which holds the receive queue.
+  auto compressor = _compressor;
+  receiveQueue(rankSender).dispatch([compressor, request, itemsToReceive, size](Socket &socket, SocketReceiveQueue::Strand &strand, std::function<void()> done) {
+    auto header  = std::make_shared<DataCompressor::Header>(0);
+    auto payload = std::make_shared<std::vector<unsigned char>>();
+    asio::async_read(socket,
+                     asio::buffer(header.get(), sizeof(DataCompressor::Header)),
+                     strand.wrap([compressor, request, itemsToReceive, size, done, header, payload, &socket, &strand](boost::system::error_code const &error, std::size_t) {
+                       if (error) {
+                         completeReceive(request, error);
+                         done();
+                         return;
+                       }
+                       payload->resize(*header);
+                       asio::async_read(socket,
+                                        asio::buffer(*payload),
+                                        strand.wrap([compressor, request, itemsToReceive, size, done, payload](boost::system::error_code const &error, std::size_t) {
+                                          if (error) {
+                                            completeReceive(request, error);
+                                          } else if (not compressor->decompress(payload->data(), payload->size(), itemsToReceive, size)) {
+                                            std::static_pointer_cast<SocketRequest>(request)->complete(
+                                                "Decompression of " + std::to_string(size) + " values received using sockets failed. "
+                                                "Make sure that both participants use the same compression.");
+                                          } else {
+                                            std::static_pointer_cast<SocketRequest>(request)->complete();
+                                          }
+                                          done();
+                                        }));
+                     }));
+  });
+
+  return request;
+}
+
 #ifndef _WIN32
 namespace {
 struct Interface {
@@ -6,23 +6,29 @@
 #include <set>
 #include <stddef.h>
 #include <string>
-#include <thread>
 #include <vector>
 #include "com/Communication.hpp"
+#include "com/DataCompressor.hpp"
 #include "com/SharedPointer.hpp"
+#include "com/SocketReceiveQueue.hpp"
 #include "com/SocketSendQueue.hpp"
 #include "logging/Logger.hpp"
 #include "utils/networking.hpp"
 
 namespace precice {
 namespace com {
-/// Implements Communication by using sockets.
+/**
+ * @brief Implements Communication by using sockets.
+ *
+ * If a DataCompressor is given, the asynchronous sends and receives of double arrays transfer compressed messages.
+ */
 class SocketCommunication : public Communication {
 public:
-  SocketCommunication(unsigned short     portNumber       = 0,
-                      bool               reuseAddress     = false,
-                      std::string const &networkName      = utils::networking::loopbackInterfaceName(),
-                      std::string const &addressDirectory = ".");
+  SocketCommunication(unsigned short        portNumber       = 0,
+                      bool                  reuseAddress     = false,
+                      std::string const &   networkName      = utils::networking::loopbackInterfaceName(),
+                      std::string const &   addressDirectory = ".",
+                      DataCompressor const &compressor       = DataCompressor());
 
   explicit SocketCommunication(std::string const &addressDirectory);
 
@@ -54,8 +60,55 @@ public:
                                          std::set<int> const &acceptorRanks,
                                          int                  requesterRank) override;
 
+  /// Establishes the Master-Slave connection and a binomial tree over all ranks for the collective operations.
+  virtual void connectMasterSlaves(std::string const &participantName,
+                                   std::string const &tag,
+                                   int                rank,
+                                   int                size) override;
+
   virtual void closeConnection() override;
 
+  /// @name Reduction
+  /// @{
+  /// Reductions use the binomial tree if it was established by connectMasterSlaves().
+
+  virtual void reduceSum(double const *itemsToSend, double *itemsToReceive, int size, int rankMaster) override;
+  virtual void reduceSum(double const *itemsToSend, double *itemsToReceive, int size) override;
+
+  virtual void reduceSum(int itemToSend, int &itemToReceive, int rankMaster) override;
+  virtual void reduceSum(int itemToSend, int &itemToReceive) override;
+
+  virtual void allreduceSum(double const *itemsToSend, double *itemsToReceive, int size, int rankMaster) override;
+  virtual void allreduceSum(double const *itemsToSend, double *itemsToReceive, int size) override;
+
+  virtual void allreduceSum(double itemToSend, double &itemToReceive, int rankMaster) override;
+  virtual void allreduceSum(double itemToSend, double &itemToReceive) override;
+
+  virtual void allreduceSum(int itemToSend, int &itemToReceive, int rankMaster) override;
+  virtual void allreduceSum(int itemToSend, int &itemToReceive) override;
+
+  /// @}
+
+  /// @name Broadcast
+  /// @{
+  /// Broadcasts use the binomial tree if it was established by connectMasterSlaves().
+
+  virtual void broadcast(const int *itemsToSend, int size) override;
+  virtual void broadcast(int *itemsToReceive, int size, int rankBroadcaster) override;
+
+  virtual void broadcast(int itemToSend) override;
+  virtual void broadcast(int &itemToReceive, int rankBroadcaster) override;
+
+  virtual void broadcast(const double *itemsToSend, int size) override;
+  virtual void broadcast(double *itemsToReceive, int size, int rankBroadcaster) override;
+
+  virtual void broadcast(double itemToSend) override;
+  virtual void broadcast(double &itemToReceive, int rankBroadcaster) override;
+
+  using Communication::broadcast;
+
+  /// @}
+
   /// Sends a std::string to process with given rank.
   virtual void send(std::string const &itemToSend, int rankReceiver) override;
 
@@ -151,18 +204,80 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
+  /// Compression of asynchronously sent and received double arrays, shared with the handlers of receives
+  std::shared_ptr<DataCompressor const> _compressor;
+
   using IOService = boost::asio::io_service;
   using Socket    = boost::asio::ip::tcp::socket;
-  using Work      = boost::asio::io_service::work;
 
+  /// Shared by all communications, see SocketIOService
   std::shared_ptr<IOService> _ioService;
-  std::shared_ptr<Work>      _work;
-  std::thread                _thread;
+
+  /// True, if this communication uses the IO threads of the SocketIOService
+  bool _usesIOThreads = false;
 
   /// Remote rank -> socket map
   std::map<int, std::shared_ptr<Socket>> _sockets;
 
-  SocketSendQueue _queue;
+  /// Remote rank -> strand of the socket, which serializes its asynchronous operations on the IO threads
+  std::map<int, std::shared_ptr<SocketSendQueue::Strand>> _strands;
+
+  /// Remote rank -> queue of asynchronous sends to this rank
+  std::map<int, std::shared_ptr<SocketSendQueue>> _queues;
+
+  /// Remote rank -> queue of asynchronous receives from this rank
+  std::map<int, std::shared_ptr<SocketReceiveQueue>> _receiveQueues;
+
+  /// Returns the strand of the socket to the given (adjusted) rank.
+  std::shared_ptr<SocketSendQueue::Strand> strand(int rank);
+
+  /// Returns the send queue of the socket to the given (adjusted) rank.
+  SocketSendQueue &queue(int rankReceiver);
+
+  /// Returns the receive queue of the socket to the given (adjusted) rank.
+  SocketReceiveQueue &receiveQueue(int rankSender);
+
+  /// Lets the IO threads fire the asynchronous handlers, once all sockets are connected.
+  void startIOThreads();
+
+  /// Connection to the parent in the binomial tree of the master-slave communication, only set on slaves
+  std::unique_ptr<SocketCommunication> _treeParent;
+
+  /// Connection to the children in the binomial tree of the master-slave communication
+  std::unique_ptr<SocketCommunication> _treeChildren;
+
+  /// Rank of the parent in the binomial tree
+  int _treeParentRank = -1;
+
+  /// Ranks of the children in the binomial tree in ascending order
+  std::vector<int> _treeChildRanks;
+
+  /// Returns true, if collective operations use the binomial tree.
+  bool hasTree() const;
+
+  /// Sums up the items of the subtree of this rank and forwards the partial sum to the parent.
+  /*
+   * On the master, itemsToReceive contains the sum over all ranks.
+   */
+  template <typename T>
+  void treeReduceSum(T const *itemsToSend, T *itemsToReceive, int size);
+
+  /// Sends the items to all children, which forward them to their subtrees.
+  template <typename T>
+  void treeBroadcastSend(T const *itemsToSend, int size);
+
+  /// Receives the items from the parent and forwards them to the children.
+  template <typename T>
+  void treeBroadcastReceive(T *itemsToReceive, int size);
+
+  /// Compresses and asynchronously sends the values, the message is owned by the request until it completes.
+  PtrRequest aSendCompressed(const double *itemsToSend, int size, int rankReceiver);
+
+  /// Asynchronously receives the buffer, after all earlier asynchronous receives from the (adjusted) rank.
+  PtrRequest aReceiveBuffer(boost::asio::mutable_buffers_1 buffer, int rankSender);
+
+  /// Asynchronously receives a compressed message and decompresses it into itemsToReceive.
+  PtrRequest aReceiveCompressed(double *itemsToReceive, int size, int rankSender);
 
   bool isClient();
   bool isServer();
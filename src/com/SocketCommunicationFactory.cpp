@@ -7,14 +7,16 @@
 namespace precice {
 namespace com {
 SocketCommunicationFactory::SocketCommunicationFactory(
-    unsigned short     portNumber,
-    bool               reuseAddress,
-    std::string const &networkName,
-    std::string const &addressDirectory)
+    unsigned short        portNumber,
+    bool                  reuseAddress,
+    std::string const &   networkName,
+    std::string const &   addressDirectory,
+    DataCompressor const &compressor)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
-      _addressDirectory(addressDirectory)
+      _addressDirectory(addressDirectory),
+      _compressor(compressor)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -30,7 +32,7 @@ SocketCommunicationFactory::SocketCommunicationFactory(
 PtrCommunication SocketCommunicationFactory::newCommunication()
 {
   return std::make_shared<SocketCommunication>(
-      _portNumber, _reuseAddress, _networkName, _addressDirectory);
+      _portNumber, _reuseAddress, _networkName, _addressDirectory, _compressor);
 }
 
 std::string SocketCommunicationFactory::addressDirectory()
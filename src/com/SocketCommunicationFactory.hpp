@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CommunicationFactory.hpp"
+#include "com/DataCompressor.hpp"
 #include "com/SharedPointer.hpp"
 #include "utils/networking.hpp"
 
@@ -10,10 +11,11 @@ namespace precice {
 namespace com {
 class SocketCommunicationFactory : public CommunicationFactory {
 public:
-  SocketCommunicationFactory(unsigned short     portNumber       = 0,
-                             bool               reuseAddress     = false,
-                             std::string const &networkName      = utils::networking::loopbackInterfaceName(),
-                             std::string const &addressDirectory = ".");
+  SocketCommunicationFactory(unsigned short        portNumber       = 0,
+                             bool                  reuseAddress     = false,
+                             std::string const &   networkName      = utils::networking::loopbackInterfaceName(),
+                             std::string const &   addressDirectory = ".",
+                             DataCompressor const &compressor       = DataCompressor());
 
   explicit SocketCommunicationFactory(std::string const &addressDirectory);
 
@@ -26,6 +28,7 @@ private:
   bool           _reuseAddress;
   std::string    _networkName;
   std::string    _addressDirectory;
+  DataCompressor _compressor;
 };
 } // namespace com
 } // namespace precice
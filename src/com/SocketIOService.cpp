@@ -0,0 +1,80 @@
+#include "com/SocketIOService.hpp"
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace com {
+
+SocketIOService &SocketIOService::instance()
+{
+  static SocketIOService instance;
+  return instance;
+}
+
+SocketIOService::SocketIOService()
+    : _ioService(std::make_shared<IOService>())
+{
+}
+
+SocketIOService::~SocketIOService()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _ioService->stop();
+  stopThreads();
+}
+
+void SocketIOService::setThreads(int threads)
+{
+  PRECICE_TRACE(threads);
+  PRECICE_ASSERT(threads >= 1, threads);
+  std::lock_guard<std::mutex> lock(_mutex);
+  _maxThreads = threads;
+  if (_users > 0) {
+    while (static_cast<int>(_threads.size()) < _maxThreads) {
+      _threads.emplace_back([this] { _ioService->run(); });
+    }
+  }
+  PRECICE_DEBUG("Using " << threads << " IO threads");
+}
+
+int SocketIOService::getThreads() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _maxThreads;
+}
+
+void SocketIOService::acquire()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_users++ > 0) {
+    return;
+  }
+  PRECICE_ASSERT(_threads.empty());
+  _ioService->reset();
+  _work.reset(new IOService::work(*_ioService));
+  for (int i = 0; i < _maxThreads; ++i) {
+    _threads.emplace_back([this] { _ioService->run(); });
+  }
+}
+
+void SocketIOService::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  PRECICE_ASSERT(_users > 0);
+  if (--_users == 0) {
+    stopThreads();
+  }
+}
+
+void SocketIOService::stopThreads()
+{
+  // Without work, the threads return as soon as the handlers of closed sockets ran.
+  _work.reset();
+  for (auto &thread : _threads) {
+    thread.join();
+  }
+  _threads.clear();
+}
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief IO service shared by all SocketCommunication objects of a participant.
+ *
+ * The asynchronous handlers of all sockets are run by a pool of IO threads. The amount of threads is
+ * configured per participant using the attribute io of the tag <threads>. The threads are started
+ * by the first communication using them and joined once the last communication released them.
+ * The operations of one socket are serialized by a strand, hence only different sockets are served in parallel.
+ */
+class SocketIOService {
+public:
+  using IOService = boost::asio::io_service;
+
+  /// Returns the only instance (singleton) of the SocketIOService class
+  static SocketIOService &instance();
+
+  SocketIOService(const SocketIOService &) = delete;
+  SocketIOService &operator=(const SocketIOService &) = delete;
+
+  /// Joins all threads, even if there are users left.
+  ~SocketIOService();
+
+  /// Returns the io_service, on which all sockets are created.
+  std::shared_ptr<IOService> ioService() const
+  {
+    return _ioService;
+  }
+
+  /// Sets the amount of IO threads. Additional threads are started immediately if the service is in use.
+  void setThreads(int threads);
+
+  /// Returns the amount of IO threads.
+  int getThreads() const;
+
+  /// Registers a user of the IO threads, the first user starts them.
+  void acquire();
+
+  /// Deregisters a user of the IO threads, the last user waits until all pending handlers finished.
+  void release();
+
+private:
+  SocketIOService();
+
+  void stopThreads();
+
+  logging::Logger _log{"com::SocketIOService"};
+
+  std::shared_ptr<IOService> _ioService;
+
+  std::unique_ptr<IOService::work> _work;
+
+  std::vector<std::thread> _threads;
+
+  mutable std::mutex _mutex;
+
+  int _maxThreads = 1;
+
+  int _users = 0;
+};
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,43 @@
+#include <utility>
+
+#include "SocketReceiveQueue.hpp"
+
+namespace precice {
+namespace com {
+
+SocketReceiveQueue::SocketReceiveQueue(std::shared_ptr<Socket> sock, std::shared_ptr<Strand> strand)
+    : _sock(std::move(sock)),
+      _strand(std::move(strand))
+{
+}
+
+void SocketReceiveQueue::dispatch(Receive receive)
+{
+  std::lock_guard<std::mutex> lock(_receiveMutex);
+  _receives.push_back(std::move(receive));
+  process(); // if queue was previously empty, start it now.
+}
+
+void SocketReceiveQueue::process()
+{
+  if (!_ready || _receives.empty())
+    return;
+
+  Receive receive = std::move(_receives.front());
+  _receives.pop_front();
+  _ready = false;
+
+  // The handlers of asio never run inside the initiating function, hence the lock is not taken twice.
+  // The callback keeps the queue alive, as it may run after the communication was closed.
+  auto self = shared_from_this();
+  _strand->dispatch([self, receive] {
+    receive(*self->_sock, *self->_strand, [self] {
+      std::lock_guard<std::mutex> lock(self->_receiveMutex);
+      self->_ready = true;
+      self->process();
+    });
+  });
+}
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace precice {
+namespace com {
+
+/// This Queue is intended for SocketCommunication to push asynchronous receives onto it.
+/// It ensures that the reads of a receive are started once all reads of the previous receive on the socket finished.
+/// Thus, the chained reads of a receive, e.g., a header followed by a payload, are never interleaved with other reads.
+/// All operations on the socket run in its strand, which it shares with the SocketSendQueue of the socket.
+class SocketReceiveQueue : public std::enable_shared_from_this<SocketReceiveQueue> {
+public:
+  using Socket = boost::asio::ip::tcp::socket;
+  using Strand = boost::asio::io_service::strand;
+
+  /**
+   * @brief Starts the reads of a receive on the socket
+   *
+   * It runs in the strand and has to wrap the handlers of its reads into the strand. Once all reads
+   * finished, it has to call the given function.
+   */
+  using Receive = std::function<void(Socket &, Strand &, std::function<void()>)>;
+
+  SocketReceiveQueue(std::shared_ptr<Socket> sock, std::shared_ptr<Strand> strand);
+
+  SocketReceiveQueue(SocketReceiveQueue const &) = delete;
+  SocketReceiveQueue &operator=(SocketReceiveQueue const &) = delete;
+
+  /// Put the receive in the queue, start processing the queue.
+  void dispatch(Receive receive);
+
+private:
+  /// Starts the next receive, if no receive is in progress. Requires a lock on _receiveMutex.
+  void process();
+
+  std::shared_ptr<Socket> _sock;
+  std::shared_ptr<Strand> _strand;
+  std::deque<Receive>     _receives;
+  std::mutex              _receiveMutex;
+  bool                    _ready = true;
+};
+
+} // namespace com
+} // namespace precice
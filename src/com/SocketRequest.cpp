@@ -1,4 +1,6 @@
 #include "SocketRequest.hpp"
+#include <utility>
+#include "logging/LogMacros.hpp"
 
 namespace precice {
 namespace com {
@@ -7,12 +9,13 @@ SocketRequest::SocketRequest()
 {
 }
 
-void SocketRequest::complete()
+void SocketRequest::complete(std::string error)
 {
   {
     std::lock_guard<std::mutex> lock(_completeMutex);
 
     _complete = true;
+    _error    = std::move(error);
   }
 
   _completeCondition.notify_one();
@@ -22,6 +25,7 @@ bool SocketRequest::test()
 {
   std::lock_guard<std::mutex> lock(_completeMutex);
 
+  checkError();
   return _complete;
 }
 
@@ -30,6 +34,12 @@ void SocketRequest::wait()
   std::unique_lock<std::mutex> lock(_completeMutex);
 
   _completeCondition.wait(lock, [this] { return _complete; });
+  checkError();
+}
+
+void SocketRequest::checkError()
+{
+  PRECICE_CHECK(_error.empty(), _error);
 }
 } // namespace com
 } // namespace precice
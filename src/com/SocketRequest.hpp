@@ -2,7 +2,9 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <string>
 #include "Request.hpp"
+#include "logging/Logger.hpp"
 
 namespace precice {
 namespace com {
@@ -10,17 +12,34 @@ class SocketRequest : public Request {
 public:
   SocketRequest();
 
-  void complete();
+  /**
+   * @brief Completes the request
+   *
+   * Completing handlers run on the IO threads, hence a failure is not raised here, but by the thread
+   * testing or waiting for the request.
+   *
+   * @param[in] error Description of the failure, empty if the request succeeded
+   */
+  void complete(std::string error = "");
 
+  /// Raises the error of a failed request.
   bool test() override;
 
+  /// Raises the error of a failed request.
   void wait() override;
 
 private:
+  logging::Logger _log{"com::SocketRequest"};
+
   bool _complete;
 
+  std::string _error;
+
   std::condition_variable _completeCondition;
   std::mutex              _completeMutex;
+
+  /// Raises the error, if the request failed. Requires a lock on _completeMutex.
+  void checkError();
 };
 } // namespace com
 } // namespace precice
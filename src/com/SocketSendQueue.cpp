@@ -3,6 +3,7 @@
 #include <iosfwd>
 #include <new>
 #include <utility>
+#include <vector>
 
 #include "SocketSendQueue.hpp"
 #include "logging/LogMacros.hpp"
@@ -12,6 +13,12 @@ namespace precice {
 namespace com {
 namespace asio = boost::asio;
 
+SocketSendQueue::SocketSendQueue(std::shared_ptr<Socket> sock, std::shared_ptr<Strand> strand)
+    : _sock(std::move(sock)),
+      _strand(std::move(strand))
+{
+}
+
 /// If items are left in the queue upon destruction, something went really wrong.
 SocketSendQueue::~SocketSendQueue()
 {
@@ -19,29 +26,44 @@ SocketSendQueue::~SocketSendQueue()
                                      "Make sure it always outlives all the requests pushed onto it.");
 }
 
-void SocketSendQueue::dispatch(std::shared_ptr<Socket>      sock,
-                               boost::asio::const_buffers_1 data,
+void SocketSendQueue::dispatch(boost::asio::const_buffers_1 data,
                                std::function<void()>        callback)
 {
-  _itemQueue.push_back({std::move(sock), std::move(data), callback});
+  std::lock_guard<std::mutex> lock(_sendMutex);
+  _itemQueue.push_back({std::move(data), std::move(callback)});
   process(); // if queue was previously empty, start it now.
 }
 
 void SocketSendQueue::process()
 {
-  std::lock_guard<std::mutex> lock(_sendMutex);
   if (!_ready || _itemQueue.empty())
     return;
-  auto item = _itemQueue.front();
-  _itemQueue.pop_front();
+
+  std::vector<asio::const_buffer>    buffers;
+  std::vector<std::function<void()>> callbacks;
+  buffers.reserve(_itemQueue.size());
+  callbacks.reserve(_itemQueue.size());
+  for (auto &item : _itemQueue) {
+    buffers.push_back(*item.data.begin());
+    callbacks.push_back(std::move(item.callback));
+  }
+  _itemQueue.clear();
   _ready = false;
-  asio::async_write(*(item.sock),
-                    item.data,
-                    [item, this](boost::system::error_code const &, std::size_t) {
-                      item.callback();
-                      this->_ready = true;
-                      this->process();
-                    });
+
+  // The handler keeps the queue alive, as it may run after the communication was closed.
+  auto self = shared_from_this();
+  _strand->dispatch([self, buffers, callbacks] {
+    asio::async_write(*self->_sock,
+                      buffers,
+                      self->_strand->wrap([self, callbacks](boost::system::error_code const &, std::size_t) {
+                        for (auto &callback : callbacks) {
+                          callback();
+                        }
+                        std::lock_guard<std::mutex> lock(self->_sendMutex);
+                        self->_ready = true;
+                        self->process();
+                      }));
+  });
 }
 
 } // namespace com
@@ -12,33 +12,38 @@ namespace precice {
 namespace com {
 
 /// This Queue is intended for SocketCommunication to push requests which should be sent onto it.
-/// It ensures that the invocations of asio::aSend are done serially.
-class SocketSendQueue {
+/// It ensures that the invocations of asio::aSend on its socket are done serially.
+/// All items queued while a send is in progress are sent together by the next scatter-gather write.
+/// Queues of different sockets are independent and make progress in parallel on the IO threads.
+/// All operations on the socket run in its strand, which it shares with the SocketReceiveQueue of the socket.
+class SocketSendQueue : public std::enable_shared_from_this<SocketSendQueue> {
 public:
   using Socket = boost::asio::ip::tcp::socket;
+  using Strand = boost::asio::io_service::strand;
 
-  SocketSendQueue() = default;
+  SocketSendQueue(std::shared_ptr<Socket> sock, std::shared_ptr<Strand> strand);
   ~SocketSendQueue();
 
   SocketSendQueue(SocketSendQueue const &) = delete;
   SocketSendQueue &operator=(SocketSendQueue const &) = delete;
 
   /// Put data in the queue, start processing the queue.
-  void dispatch(std::shared_ptr<Socket> sock, boost::asio::const_buffers_1 data, std::function<void()> callback);
+  void dispatch(boost::asio::const_buffers_1 data, std::function<void()> callback);
 
 private:
-  /// This method can be called arbitrarily many times, but enough times to ensure the queue makes progress.
+  /// Sends all queued items, if no send is in progress. Requires a lock on _sendMutex.
   void process();
 
   struct SendItem {
-    std::shared_ptr<Socket>      sock;
     boost::asio::const_buffers_1 data;
     std::function<void()>        callback;
   };
 
-  std::deque<SendItem> _itemQueue;
-  std::mutex           _sendMutex;
-  bool                 _ready = true;
+  std::shared_ptr<Socket> _sock;
+  std::shared_ptr<Strand> _strand;
+  std::deque<SendItem>    _itemQueue;
+  std::mutex              _sendMutex;
+  bool                    _ready = true;
 };
 
 } // namespace com
@@ -0,0 +1,100 @@
+#ifndef PRECICE_NO_SHM
+
+#include <vector>
+#include "GenericTestFunctions.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMM)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMS)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>(context);
+}
+
+/// Messages larger than the ring buffers, asynchronous sends in both directions before the receives
+BOOST_AUTO_TEST_CASE(ExchangeLargeMessages)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  SharedMemoryCommunication com(".", 1000);
+
+  std::vector<double> message(10000);
+  for (std::size_t i = 0; i < message.size(); ++i) {
+    message[i] = i;
+  }
+  std::vector<double> received(message.size(), -1.0);
+  std::vector<double> expected(message.size());
+
+  if (context.isNamed("A")) {
+    com.acceptConnection("A", "B", "", 0);
+    for (std::size_t i = 0; i < message.size(); ++i) {
+      expected[i] = 2.0 * i;
+    }
+  } else {
+    com.requestConnection("A", "B", "", 0, 1);
+    for (std::size_t i = 0; i < message.size(); ++i) {
+      expected[i] = i;
+      message[i]  = 2.0 * i;
+    }
+  }
+  auto sendRequest    = com.aSend(message, 0);
+  auto receiveRequest = com.aReceive(received, 0);
+  int  marker         = 7;
+  com.send(marker, 0);
+  receiveRequest->wait();
+  com.receive(marker, 0);
+  sendRequest->wait();
+
+  BOOST_TEST(received == expected, boost::test_tools::per_element());
+  BOOST_TEST(marker == 7);
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
+
+#endif // not PRECICE_NO_SHM
@@ -1,10 +1,14 @@
+#include <cmath>
 #include <vector>
 #include "GenericTestFunctions.hpp"
+#include "com/DataCompressor.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunication.hpp"
+#include "com/SocketIOService.hpp"
 #include "math/constants.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/networking.hpp"
 
 using namespace precice;
 using namespace precice::com;
@@ -57,5 +61,170 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2)
   TestSendReceiveFourProcessesServerClientV2<SocketCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(CollectivesTreeMS)
+{
+  PRECICE_TEST(4_ranks, Require::Events);
+  SocketCommunication com;
+  com.connectMasterSlaves("Tree", "", context.rank, context.size);
+
+  {
+    std::vector<double> msg{1.0 * context.rank, 2.0, -1.0};
+    std::vector<double> rcv{0, 0, 0};
+    if (context.isMaster()) {
+      com.reduceSum(msg.data(), rcv.data(), msg.size());
+      BOOST_TEST(rcv == std::vector<double>({6, 8, -4}), boost::test_tools::per_element());
+    } else {
+      com.reduceSum(msg.data(), rcv.data(), msg.size(), 0);
+      BOOST_TEST(rcv == std::vector<double>({0, 0, 0}), boost::test_tools::per_element());
+    }
+  }
+  {
+    int rcv = 0;
+    if (context.isMaster()) {
+      com.allreduceSum(context.rank + 1, rcv);
+    } else {
+      com.allreduceSum(context.rank + 1, rcv, 0);
+    }
+    BOOST_TEST(rcv == 10);
+  }
+  {
+    double rcv = 0;
+    if (context.isMaster()) {
+      com.allreduceSum(0.5, rcv);
+    } else {
+      com.allreduceSum(0.5, rcv, 0);
+    }
+    BOOST_TEST(rcv == 2.0);
+  }
+  {
+    std::vector<int> msg;
+    if (context.isMaster()) {
+      msg = {2, 3, 5, 8};
+      com.broadcast(msg);
+    } else {
+      com.broadcast(msg, 0);
+    }
+    BOOST_TEST(msg == std::vector<int>({2, 3, 5, 8}));
+  }
+  com.closeConnection();
+}
+
+#ifndef PRECICE_NO_ZLIB
+BOOST_AUTO_TEST_CASE(CompressedAsynchronousData)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+
+  std::vector<double> values(1000);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = std::sin(0.01 * i) * 1e5;
+  }
+  values[7] = 0.0;
+
+  for (auto mode : {DataCompressor::Mode::Lossless, DataCompressor::Mode::Lossy}) {
+    const double        tolerance = 1e-4;
+    const std::string   tag       = (mode == DataCompressor::Mode::Lossy) ? "lossy" : "lossless";
+    SocketCommunication com(0, false, utils::networking::loopbackInterfaceName(), ".", DataCompressor(mode, tolerance));
+
+    if (context.isNamed("A")) {
+      com.acceptConnection("A", "B", tag, 0);
+      auto                request = com.aSend(values, 0);
+      std::vector<double> shortMessage{1.5, 2.5};
+      com.aSend(shortMessage.data(), shortMessage.size(), 0)->wait();
+      request->wait();
+    } else {
+      com.requestConnection("A", "B", tag, 0, 1);
+      std::vector<double> received(values.size(), 0.0);
+      com.aReceive(received, 0)->wait();
+      if (mode == DataCompressor::Mode::Lossless) {
+        BOOST_TEST(received == values, boost::test_tools::per_element());
+      } else {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+          BOOST_TEST(std::abs(received[i] - values[i]) <= tolerance * std::abs(values[i]));
+        }
+      }
+      std::vector<double> shortMessage(2, 0.0);
+      com.aReceive(shortMessage.data(), shortMessage.size(), 0)->wait();
+      BOOST_TEST(shortMessage == std::vector<double>({1.5, 2.5}), boost::test_tools::per_element());
+    }
+    com.closeConnection();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CompressedReceivesInFlight)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank));
+
+  SocketIOService::instance().setThreads(3);
+  {
+    // The header and payload reads of all outstanding receives must not interleave.
+    constexpr int       messages = 50;
+    SocketCommunication com(0, false, utils::networking::loopbackInterfaceName(), ".", DataCompressor(DataCompressor::Mode::Lossless));
+    if (context.isNamed("A")) {
+      com.acceptConnection("A", "B", "", 0);
+      std::vector<std::vector<double>> data(messages);
+      std::vector<PtrRequest>          requests;
+      for (int i = 0; i < messages; ++i) {
+        data[i].assign(1 + 97 * i, i);
+        requests.push_back(com.aSend(data[i], 0));
+      }
+      Request::wait(requests);
+    } else {
+      com.requestConnection("A", "B", "", 0, 1);
+      std::vector<std::vector<double>> received(messages);
+      std::vector<PtrRequest>          requests;
+      for (int i = 0; i < messages; ++i) {
+        received[i].assign(1 + 97 * i, -1.0);
+        requests.push_back(com.aReceive(received[i], 0));
+      }
+      Request::wait(requests);
+      for (int i = 0; i < messages; ++i) {
+        BOOST_TEST(received[i] == std::vector<double>(received[i].size(), i), boost::test_tools::per_element());
+      }
+    }
+    com.closeConnection();
+  }
+  SocketIOService::instance().setThreads(1);
+}
+#endif // not PRECICE_NO_ZLIB
+
+BOOST_AUTO_TEST_CASE(QueuedSendsWithSharedIOThreads)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank));
+
+  SocketIOService::instance().setThreads(3);
+  {
+    // Both communications share the IO threads, their sends progress independently.
+    SocketCommunication first, second;
+    if (context.isNamed("A")) {
+      first.acceptConnection("A", "B", "first", 0);
+      second.acceptConnection("A", "B", "second", 0);
+
+      constexpr int                    messages = 200;
+      std::vector<std::vector<double>> data(messages);
+      std::vector<PtrRequest>          requests;
+      for (int i = 0; i < messages; ++i) {
+        data[i].assign(1 + i % 17, i);
+        requests.push_back(first.aSend(data[i], 0));
+        requests.push_back(second.aSend(data[i].data(), data[i].size(), 0));
+      }
+      Request::wait(requests);
+    } else {
+      first.requestConnection("A", "B", "first", 0, 1);
+      second.requestConnection("A", "B", "second", 0, 1);
+
+      for (int i = 0; i < 200; ++i) {
+        for (auto com : {&second, &first}) {
+          std::vector<double> received(1 + i % 17, -1.0);
+          com->receive(received.data(), received.size(), 0);
+          BOOST_TEST(received == std::vector<double>(received.size(), i), boost::test_tools::per_element());
+        }
+      }
+    }
+    first.closeConnection();
+    second.closeConnection();
+  }
+  SocketIOService::instance().setThreads(1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -1,10 +1,14 @@
 #include "BaseCouplingScheme.hpp"
 #include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <map>
 #include <math.h>
 #include <sstream>
 #include <stddef.h>
 #include <utility>
+#include <vector>
 #include "acceleration/Acceleration.hpp"
 #include "cplscheme/Constants.hpp"
 #include "cplscheme/CouplingData.hpp"
@@ -16,6 +20,7 @@
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/MasterSlave.hpp"
 
@@ -66,37 +71,100 @@ BaseCouplingScheme::BaseCouplingScheme(
   }
 }
 
+namespace {
+/// Returns the coupling data grouped by mesh ID, in ascending order of data IDs within each mesh
+std::map<int, std::vector<CouplingData *>> groupByMesh(const std::map<int, PtrCouplingData> &dataMap)
+{
+  std::map<int, std::vector<CouplingData *>> groups;
+  for (const auto &pair : dataMap) {
+    groups[pair.second->mesh->getID()].push_back(pair.second.get());
+  }
+  return groups;
+}
+
+/// Returns the sum of the dimensions of all data
+int sumDimensions(const std::vector<CouplingData *> &data)
+{
+  int dimensions = 0;
+  for (CouplingData *entry : data) {
+    dimensions += entry->getDimensions();
+  }
+  return dimensions;
+}
+} // namespace
+
 void BaseCouplingScheme::sendData(m2n::PtrM2N m2n, DataMap sendData)
 {
   PRECICE_TRACE();
-  std::vector<int> sentDataIDs;
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
-  for (const DataMap::value_type &pair : sendData) {
-    int size = pair.second->values().size();
-    if (size > 0) {
-      m2n->send(pair.second->values().data(), size, pair.second->mesh->getID(), pair.second->getDimensions());
+  // All data of one mesh is packed vertex by vertex into one message per remote rank
+  for (const auto &group : groupByMesh(sendData)) {
+    const std::vector<CouplingData *> &data = group.second;
+    if (data.size() == 1) {
+      int size = data.front()->values().size();
+      if (size > 0) {
+        m2n->send(data.front()->values().data(), size, group.first, data.front()->getDimensions());
+      }
+      continue;
+    }
+
+    const int dimensions = sumDimensions(data);
+    const int vertices   = data.front()->values().size() / data.front()->getDimensions();
+    if (vertices == 0) {
+      continue;
+    }
+    _exchangeBuffer.resize(vertices * dimensions);
+    int offset = 0;
+    for (CouplingData *entry : data) {
+      const int entryDimensions = entry->getDimensions();
+      PRECICE_ASSERT(entry->values().size() == vertices * entryDimensions, entry->values().size(), vertices, entryDimensions);
+      for (int i = 0; i < vertices; ++i) {
+        std::copy_n(entry->values().data() + i * entryDimensions, entryDimensions, _exchangeBuffer.data() + i * dimensions + offset);
+      }
+      offset += entryDimensions;
     }
-    sentDataIDs.push_back(pair.first);
+    m2n->send(_exchangeBuffer.data(), _exchangeBuffer.size(), group.first, dimensions);
   }
-  PRECICE_DEBUG("Number of sent data sets = " << sentDataIDs.size());
+  PRECICE_DEBUG("Number of sent data sets = " << sendData.size());
 }
 
 void BaseCouplingScheme::receiveData(m2n::PtrM2N m2n, DataMap receiveData)
 {
   PRECICE_TRACE();
-  std::vector<int> receivedDataIDs;
   PRECICE_ASSERT(m2n.get());
   PRECICE_ASSERT(m2n->isConnected());
-  for (DataMap::value_type &pair : receiveData) {
-    int size = pair.second->values().size();
-    if (size > 0) {
-      m2n->receive(pair.second->values().data(), size, pair.second->mesh->getID(), pair.second->getDimensions());
+
+  // Counterpart of sendData(), the data of one mesh arrives in one message per remote rank
+  for (const auto &group : groupByMesh(receiveData)) {
+    const std::vector<CouplingData *> &data = group.second;
+    if (data.size() == 1) {
+      int size = data.front()->values().size();
+      if (size > 0) {
+        m2n->receive(data.front()->values().data(), size, group.first, data.front()->getDimensions());
+      }
+      continue;
+    }
+
+    const int dimensions = sumDimensions(data);
+    const int vertices   = data.front()->values().size() / data.front()->getDimensions();
+    if (vertices == 0) {
+      continue;
+    }
+    _exchangeBuffer.resize(vertices * dimensions);
+    m2n->receive(_exchangeBuffer.data(), _exchangeBuffer.size(), group.first, dimensions);
+    int offset = 0;
+    for (CouplingData *entry : data) {
+      const int entryDimensions = entry->getDimensions();
+      PRECICE_ASSERT(entry->values().size() == vertices * entryDimensions, entry->values().size(), vertices, entryDimensions);
+      for (int i = 0; i < vertices; ++i) {
+        std::copy_n(_exchangeBuffer.data() + i * dimensions + offset, entryDimensions, entry->values().data() + i * entryDimensions);
+      }
+      offset += entryDimensions;
     }
-    receivedDataIDs.push_back(pair.first);
   }
-  PRECICE_DEBUG("Number of received data sets = " << receivedDataIDs.size());
+  PRECICE_DEBUG("Number of received data sets = " << receiveData.size());
 }
 
 void BaseCouplingScheme::store(DataMap data)
@@ -152,6 +220,11 @@ void BaseCouplingScheme::initialize(double startTime, int startTimeWindow)
     initializeTXTWriters();
   }
 
+  // Restore the state before any data is received, which must not be overwritten.
+  if (not _restartState.empty()) {
+    applyRestartState();
+  }
+
   initializeImplementation();
 
   if (sendsInitializedData()) {
@@ -182,19 +255,36 @@ void BaseCouplingScheme::initializeData()
 }
 
 void BaseCouplingScheme::advance()
+{
+  startAdvance();
+  finishAdvance();
+}
+
+void BaseCouplingScheme::startAdvance()
 {
   PRECICE_TRACE(_timeWindows, _time);
   checkCompletenessRequiredActions();
   PRECICE_ASSERT(_isInitialized, "Before calling advance() coupling scheme has to be initialized via initialize().");
+  PRECICE_ASSERT(not _isAdvancing, "startAdvance() was called twice without finishAdvance().");
   _hasDataBeenReceived  = false;
   _isTimeWindowComplete = false;
+  _isAdvancing          = true;
 
   PRECICE_ASSERT(_couplingMode != Undefined);
 
   if (reachedEndOfTimeWindow()) {
-
     _timeWindows += 1; // increment window counter. If not converged, will be decremented again later.
+    startDataExchange();
+  }
+}
 
+void BaseCouplingScheme::finishAdvance()
+{
+  PRECICE_TRACE(_timeWindows, _time);
+  PRECICE_ASSERT(_isAdvancing, "finishAdvance() was called without startAdvance().");
+  _isAdvancing = false;
+
+  if (reachedEndOfTimeWindow()) {
     bool convergence = exchangeDataAndAccelerate();
 
     if (isImplicitCouplingScheme()) { // check convergence
@@ -410,6 +500,106 @@ std::string BaseCouplingScheme::printCouplingState() const
   return os.str();
 }
 
+void BaseCouplingScheme::exportState(std::ostream &out)
+{
+  PRECICE_TRACE(_timeWindows, _time);
+  PRECICE_ASSERT(_isTimeWindowComplete, "The coupling state can only be exported at the end of a time window.");
+
+  std::ostringstream state;
+  utils::writeBinary(state, _time);
+  utils::writeBinary(state, _timeWindows);
+  utils::writeBinary(state, _iterations);
+  utils::writeBinary(state, _totalIterations);
+
+  DataMap allData = getAllData();
+  utils::writeBinary(state, static_cast<std::int64_t>(allData.size()));
+  for (DataMap::value_type &pair : allData) {
+    // Data is identified by name, as data IDs depend on the order of the configuration.
+    utils::writeBinary(state, pair.second->mesh->getName());
+    utils::writeBinary(state, pair.second->data->getName());
+    utils::writeBinary(state, pair.second->values());
+    utils::writeBinary(state, pair.second->oldValues);
+  }
+
+  // The acceleration is only initialized for the participant, which accelerates the data.
+  const bool hasAcceleration = isImplicitCouplingScheme() && not doesFirstStep() && _acceleration != nullptr;
+  utils::writeBinary(state, hasAcceleration);
+  if (hasAcceleration) {
+    _acceleration->exportState(state);
+  }
+
+  // Prefix the block with its size, such that compositional schemes can read the block of each scheme.
+  const std::string block = state.str();
+  utils::writeBinary(out, static_cast<std::int64_t>(block.size()));
+  out.write(block.data(), block.size());
+}
+
+void BaseCouplingScheme::importState(std::istream &in)
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(not _isInitialized, "The coupling state has to be imported before initialize().");
+
+  std::int64_t size = 0;
+  utils::readBinary(in, size);
+  PRECICE_CHECK(in && size > 0, "Reading the coupling state from the restart checkpoint failed.");
+  _restartState.resize(size);
+  in.read(&_restartState[0], size);
+  PRECICE_CHECK(in, "Reading the coupling state from the restart checkpoint failed.");
+}
+
+void BaseCouplingScheme::applyRestartState()
+{
+  PRECICE_TRACE();
+  std::istringstream in(_restartState);
+  _restartState.clear();
+
+  utils::readBinary(in, _time);
+  utils::readBinary(in, _timeWindows);
+  utils::readBinary(in, _iterations);
+  utils::readBinary(in, _totalIterations);
+
+  DataMap      allData   = getAllData();
+  std::int64_t dataCount = 0;
+  utils::readBinary(in, dataCount);
+  PRECICE_CHECK(in && dataCount == static_cast<std::int64_t>(allData.size()),
+                "The restart checkpoint contains " << dataCount << " coupling data, but the coupling scheme exchanges "
+                                                   << allData.size() << " data. Make sure to restart with the same configuration.");
+  for (std::int64_t i = 0; i < dataCount; i++) {
+    std::string     meshName;
+    std::string     dataName;
+    Eigen::VectorXd values;
+    Eigen::MatrixXd oldValues;
+    utils::readBinary(in, meshName);
+    utils::readBinary(in, dataName);
+    utils::readBinary(in, values);
+    utils::readBinary(in, oldValues);
+    PRECICE_CHECK(in, "Reading the coupling state from the restart checkpoint failed.");
+    auto match = std::find_if(allData.begin(), allData.end(), [&](const DataMap::value_type &pair) {
+      return pair.second->mesh->getName() == meshName && pair.second->data->getName() == dataName;
+    });
+    PRECICE_CHECK(match != allData.end(),
+                  "The restart checkpoint contains data \"" << dataName << "\" on mesh \"" << meshName
+                                                             << "\", which is not exchanged by the coupling scheme.");
+    CouplingData &data = *match->second;
+    PRECICE_CHECK(values.size() == data.values().size() && oldValues.rows() == data.oldValues.rows() && oldValues.cols() == data.oldValues.cols(),
+                  "The values of data \"" << data.data->getName() << "\" in the restart checkpoint do not match the coupling mesh. "
+                                           << "Make sure to restart with the same mesh partition and configuration.");
+    data.values()  = values;
+    data.oldValues = oldValues;
+  }
+
+  const bool hasAcceleration      = isImplicitCouplingScheme() && not doesFirstStep() && _acceleration != nullptr;
+  bool       hasAccelerationState = false;
+  utils::readBinary(in, hasAccelerationState);
+  PRECICE_CHECK(in && hasAccelerationState == hasAcceleration,
+                "The acceleration of the restart checkpoint does not match the configured acceleration.");
+  if (hasAcceleration) {
+    _acceleration->importState(in);
+  }
+  PRECICE_CHECK(in, "Reading the coupling state from the restart checkpoint failed.");
+  PRECICE_INFO("Restarted coupling from time " << _time << " after " << _timeWindows - 1 << " time windows");
+}
+
 std::string BaseCouplingScheme::printBasicState(
     int    timeWindows,
     double time) const
@@ -2,8 +2,10 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <istream>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <set>
 #include <string>
 #include <vector>
@@ -187,6 +189,12 @@ public:
    */
   std::string printCouplingState() const override;
 
+  /// Writes time, coupling data and the state of the acceleration as one block.
+  void exportState(std::ostream &out) override final;
+
+  /// Reads the block written by exportState(), which is applied in initialize().
+  void importState(std::istream &in) override final;
+
   /// Finalizes the coupling scheme.
   void finalize() override final;
 
@@ -211,6 +219,12 @@ public:
    */
   void advance() override final;
 
+  /// Starts advance() by calling startDataExchange() at the end of a time window.
+  void startAdvance() override final;
+
+  /// Completes advance() started by startAdvance().
+  void finishAdvance() override final;
+
   /**
    * @brief Sets order of predictor of interface values for first participant.
    *
@@ -254,10 +268,14 @@ protected:
   /// Map that links DataID to CouplingData
   typedef std::map<int, PtrCouplingData> DataMap;
 
-  /// Sends data sendDataIDs given in mapCouplingData with communication.
+  /**
+   * @brief Sends data sendDataIDs given in mapCouplingData with communication.
+   *
+   * All data of one mesh is packed into one message per remote rank.
+   */
   void sendData(m2n::PtrM2N m2n, DataMap sendData);
 
-  /// Receives data receiveDataIDs given in mapCouplingData with communication.
+  /// Receives data receiveDataIDs given in mapCouplingData with communication, counterpart of sendData().
   void receiveData(m2n::PtrM2N m2n, DataMap receiveData);
 
   /**
@@ -467,6 +485,9 @@ private:
   /// Number of total iterations performed.
   int _totalIterations = -1;
 
+  /// Buffer for the data of one mesh packed by sendData() and receiveData(), reused between exchanges.
+  std::vector<double> _exchangeBuffer;
+
   /// Extrapolation order of coupling data for first iteration of every dt.
   int _extrapolationOrder = 0;
 
@@ -491,6 +512,9 @@ private:
   /// True, if data has been received from other participant. Flag is used to make sure that coupling scheme is implemented and used correctly.
   bool _hasDataBeenReceived = false;
 
+  /// True between startAdvance() and finishAdvance().
+  bool _isAdvancing = false;
+
   /// True, if coupling has been initialized.
   bool _isInitialized = false;
 
@@ -499,6 +523,9 @@ private:
 
   std::set<std::string> _actions;
 
+  /// State read by importState(), applied in initialize().
+  std::string _restartState;
+
   /// Responsible for monitoring iteration count over time window.
   std::shared_ptr<io::TXTTableWriter> _iterationsWriter;
 
@@ -541,7 +568,14 @@ private:
   /// Functions needed for advance()
 
   /**
-   * @brief implements functionality for advance in base class.
+   * @brief Starts the data exchange at the end of a time window, called by startAdvance().
+   *
+   * Does the part of the exchange, which does not need to receive data. By default, nothing.
+   */
+  virtual void startDataExchange() {}
+
+  /**
+   * @brief implements functionality for advance in base class, completes startDataExchange().
    * @returns true, if iteration converged
    */
   virtual bool exchangeDataAndAccelerate() = 0;
@@ -552,6 +586,15 @@ private:
    */
   virtual DataMap &getAccelerationData() = 0;
 
+  /**
+   * @brief interface to provide all send and receive data, needed to export and import the state
+   * @return map of all data
+   */
+  virtual DataMap getAllData() = 0;
+
+  /// Restores time, coupling data and the state of the acceleration from _restartState.
+  void applyRestartState();
+
   /**
    * @brief If any required actions are open, an error message is issued.
    */
@@ -135,6 +135,14 @@ private:
     }
   }
 
+  /// Merges send and receive data into one map.
+  DataMap getAllData() override
+  {
+    DataMap allData = getSendData();
+    allData.insert(getReceiveData().begin(), getReceiveData().end());
+    return allData;
+  }
+
   /**
    * @brief BiCouplingScheme has to call store for receive and send data
    */
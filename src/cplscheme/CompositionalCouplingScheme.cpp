@@ -300,6 +300,22 @@ std::string CompositionalCouplingScheme::printCouplingState() const
   return state;
 }
 
+void CompositionalCouplingScheme::exportState(std::ostream &out)
+{
+  PRECICE_TRACE();
+  for (Scheme scheme : _couplingSchemes) {
+    scheme.scheme->exportState(out);
+  }
+}
+
+void CompositionalCouplingScheme::importState(std::istream &in)
+{
+  PRECICE_TRACE();
+  for (Scheme scheme : _couplingSchemes) {
+    scheme.scheme->importState(in);
+  }
+}
+
 bool CompositionalCouplingScheme::determineActiveCouplingSchemes()
 {
   PRECICE_TRACE();
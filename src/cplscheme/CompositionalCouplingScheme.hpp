@@ -215,6 +215,12 @@ public:
   /// Returns a string representation of the current coupling state.
   std::string printCouplingState() const final override;
 
+  /// Writes the states of all composed coupling schemes in the order they were added.
+  void exportState(std::ostream &out) final override;
+
+  /// Reads the states of all composed coupling schemes in the order they were added.
+  void importState(std::istream &in) final override;
+
 private:
   mutable logging::Logger _log{"cplscheme::CompositionalCouplingScheme"};
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <istream>
 #include <map>
+#include <ostream>
 #include <string>
 #include <vector>
 #include "com/SharedPointer.hpp"
@@ -104,6 +106,22 @@ public:
    */
   virtual void advance() = 0;
 
+  /**
+   * @brief Starts advance(), sends all data which does not depend on data received in this advance.
+   *
+   * Calling startAdvance() followed by finishAdvance() is equivalent to advance().
+   * By default, all work is done in finishAdvance().
+   *
+   * @pre initialize() has been called.
+   */
+  virtual void startAdvance() {}
+
+  /// Completes advance() started by startAdvance().
+  virtual void finishAdvance()
+  {
+    advance();
+  }
+
   /// Finalizes the coupling and disconnects communication.
   virtual void finalize() = 0;
 
@@ -178,6 +196,25 @@ public:
 
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const = 0;
+
+  /**
+   * @brief Writes the state, which is needed to restart the coupling, in binary form.
+   *
+   * The state comprises the time, the coupling data and the state of the acceleration.
+   *
+   * @pre isTimeWindowComplete() is true.
+   */
+  virtual void exportState(std::ostream &out) = 0;
+
+  /**
+   * @brief Reads the state written by exportState() to restart the coupling.
+   *
+   * The state is applied in initialize(), before any data is received. The time
+   * and time window given to initialize() are overwritten by the restored ones.
+   *
+   * @pre initialize() has not been called yet.
+   */
+  virtual void importState(std::istream &in) = 0;
 };
 
 } // namespace cplscheme
@@ -136,6 +136,21 @@ private:
    */
   void assignDataToConvergenceMeasure(ConvergenceMeasureContext *convergenceMeasure, int dataID) override;
 
+  /**
+   * @brief merges the data of all send and receive maps, independent of mergeData()
+   */
+  DataMap getAllData() override
+  {
+    DataMap allData;
+    for (const DataMap &sendData : _sendDataVector) {
+      allData.insert(sendData.begin(), sendData.end());
+    }
+    for (const DataMap &receiveData : _receiveDataVector) {
+      allData.insert(receiveData.begin(), receiveData.end());
+    }
+    return allData;
+  }
+
   /**
    * @brief MultiCouplingScheme has to call store for all receive and send data in the vectors
    */
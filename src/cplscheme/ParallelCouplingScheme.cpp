@@ -51,13 +51,29 @@ void ParallelCouplingScheme::exchangeInitialData()
   }
 }
 
+bool ParallelCouplingScheme::sendsBeforeReceiving()
+{
+  if (doesFirstStep()) {
+    return true;
+  }
+  // The second participant has to accelerate the received data in implicit coupling. Otherwise,
+  // it can send at the same time as the first participant, if the sends do not wait for a receive.
+  return not isImplicitCouplingScheme() && getM2N()->isSendAsynchronous();
+}
+
+void ParallelCouplingScheme::startDataExchange()
+{
+  if (sendsBeforeReceiving()) {
+    PRECICE_DEBUG("Sending data...");
+    sendData(getM2N(), getSendData());
+  }
+}
+
 bool ParallelCouplingScheme::exchangeDataAndAccelerate()
 {
   bool convergence = true;
 
   if (doesFirstStep()) { //first participant
-    PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
     PRECICE_DEBUG("Receiving data...");
     if (isImplicitCouplingScheme()) {
       convergence = receiveConvergence();
@@ -73,8 +89,10 @@ bool ParallelCouplingScheme::exchangeDataAndAccelerate()
       convergence = accelerate();
       sendConvergence(getM2N(), convergence);
     }
-    PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
+    if (not sendsBeforeReceiving()) {
+      PRECICE_DEBUG("Sending data...");
+      sendData(getM2N(), getSendData());
+    }
   }
 
   return convergence;
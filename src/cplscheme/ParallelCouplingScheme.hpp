@@ -53,8 +53,17 @@ private:
   /// Map from data ID -> all data (receive and send) with that ID
   DataMap _allData;
 
+  /// Returns true, if this participant sends its data before it receives data in a time window.
+  bool sendsBeforeReceiving();
+
+  /// Sends the data of the participants, which send before they receive.
+  void startDataExchange() override;
+
   /**
    * @brief Exchanges all data between the participants of the ParallelCouplingScheme and applies acceleration.
+   *
+   * Completes startDataExchange().
+   *
    * @returns true, if iteration converged
    */
   bool exchangeDataAndAccelerate() override;
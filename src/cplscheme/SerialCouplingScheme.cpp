@@ -93,10 +93,8 @@ void SerialCouplingScheme::exchangeInitialData()
   }
 }
 
-bool SerialCouplingScheme::exchangeDataAndAccelerate()
+void SerialCouplingScheme::startDataExchange()
 {
-  bool convergence = true;
-
   if (doesFirstStep()) { // first participant
     PRECICE_DEBUG("Sending data...");
     if (_participantSetsTimeWindowSize) {
@@ -104,6 +102,23 @@ bool SerialCouplingScheme::exchangeDataAndAccelerate()
       getM2N()->send(getComputedTimeWindowPart());
     }
     sendData(getM2N(), getSendData());
+  } else { // second participant
+    _convergence = true;
+    if (isImplicitCouplingScheme()) {
+      PRECICE_DEBUG("Test Convergence and accelerate...");
+      _convergence = accelerate();
+      sendConvergence(getM2N(), _convergence);
+    }
+    PRECICE_DEBUG("Sending data...");
+    sendData(getM2N(), getSendData());
+  }
+}
+
+bool SerialCouplingScheme::exchangeDataAndAccelerate()
+{
+  bool convergence = true;
+
+  if (doesFirstStep()) { // first participant
     if (isImplicitCouplingScheme()) {
       convergence = receiveConvergence();
     }
@@ -111,13 +126,7 @@ bool SerialCouplingScheme::exchangeDataAndAccelerate()
     receiveData(getM2N(), getReceiveData());
     checkDataHasBeenReceived();
   } else { // second participant
-    if (isImplicitCouplingScheme()) {
-      PRECICE_DEBUG("Test Convergence and accelerate...");
-      convergence = accelerate();
-      sendConvergence(getM2N(), convergence);
-    }
-    PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
+    convergence = _convergence;
     // the second participant does not want new data in the last iteration of the last time window
     if (isCouplingOngoing() || (isImplicitCouplingScheme() && not convergence)) {
       if (_participantReceivesTimeWindowSize) {
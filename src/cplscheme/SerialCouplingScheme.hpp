@@ -55,11 +55,17 @@ private:
   /// Determines, if the time window size is received by the participant.
   bool _participantReceivesTimeWindowSize = false;
 
+  /// Convergence determined by the second participant in startDataExchange().
+  bool _convergence = true;
+
   /// Receives and sets the time window size, if this participant is the one to receive
   void receiveAndSetTimeWindowSize();
 
+  /// Sends the data, the second participant accelerates before.
+  void startDataExchange() override;
+
   /**
-   * @brief Exchanges data between the participants of the SerialCouplingSchemes and applies acceleration.
+   * @brief Receives the data of the other participant, completes startDataExchange().
    * @returns true, if iteration converged
    */
   bool exchangeDataAndAccelerate() override;
@@ -222,6 +222,16 @@ public:
     return std::string();
   }
 
+  /**
+   * @brief Empty.
+   */
+  void exportState(std::ostream &out) override final {}
+
+  /**
+   * @brief Empty.
+   */
+  void importState(std::istream &in) override final {}
+
 private:
   mutable logging::Logger _log{"cplscheme::tests::DummyCouplingScheme"};
 
@@ -318,6 +318,66 @@ BOOST_AUTO_TEST_CASE(testSimpleExplicitCoupling)
   runSimpleExplicitCoupling(cplScheme, context.name, meshConfig);
 }
 
+/// Test that runs on 2 processors.
+BOOST_AUTO_TEST_CASE(testExchangeSeveralDataPerMesh)
+{
+  PRECICE_TEST("Participant0"_on(1_rank), "Participant1"_on(1_rank), Require::Events);
+  testing::ConnectionOptions options;
+  options.useOnlyMasterCom = true;
+  auto m2n                 = context.connectMasters("Participant0", "Participant1", options);
+
+  // The data of one mesh is exchanged in one message, the data of another mesh separately
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false, testing::nextMeshID()));
+  mesh::PtrData scalarData = mesh->createData("ScalarData", 1);
+  mesh::PtrData vectorData = mesh->createData("VectorData", 3);
+  mesh::PtrData returnData = mesh->createData("ReturnData", 1);
+  mesh->createVertex(Eigen::Vector3d::Zero());
+  mesh->createVertex(Eigen::Vector3d::Constant(1.0));
+  mesh->allocateDataValues();
+  mesh::PtrMesh otherMesh(new mesh::Mesh("OtherMesh", 3, false, testing::nextMeshID()));
+  mesh::PtrData otherData = otherMesh->createData("OtherData", 3);
+  otherMesh->createVertex(Eigen::Vector3d::Zero());
+  otherMesh->allocateDataValues();
+
+  std::string nameParticipant0("Participant0");
+  std::string nameParticipant1("Participant1");
+  cplscheme::SerialCouplingScheme cplScheme(
+      1.0, 1, 1.0, 12, nameParticipant0, nameParticipant1, context.name, m2n,
+      constants::FIXED_TIME_WINDOW_SIZE, BaseCouplingScheme::Explicit);
+
+  if (context.isNamed(nameParticipant0)) {
+    cplScheme.addDataToSend(scalarData, mesh, false);
+    cplScheme.addDataToSend(vectorData, mesh, false);
+    cplScheme.addDataToSend(otherData, otherMesh, false);
+    cplScheme.addDataToReceive(returnData, mesh, false);
+    cplScheme.initialize(0.0, 1);
+    scalarData->values() << 1.0, 2.0;
+    vectorData->values().setLinSpaced(3.0, 8.0);
+    otherData->values() << 9.0, 10.0, 11.0;
+    cplScheme.addComputedTime(1.0);
+    cplScheme.advance();
+    BOOST_TEST(cplScheme.hasDataBeenReceived());
+    BOOST_TEST(testing::equals(returnData->values(), Eigen::Vector2d(12.0, 13.0)));
+  } else {
+    cplScheme.addDataToReceive(scalarData, mesh, false);
+    cplScheme.addDataToReceive(vectorData, mesh, false);
+    cplScheme.addDataToReceive(otherData, otherMesh, false);
+    cplScheme.addDataToSend(returnData, mesh, false);
+    cplScheme.initialize(0.0, 1);
+    BOOST_TEST(cplScheme.hasDataBeenReceived());
+    Eigen::VectorXd expectedVector(6);
+    expectedVector.setLinSpaced(3.0, 8.0);
+    BOOST_TEST(testing::equals(scalarData->values(), Eigen::Vector2d(1.0, 2.0)));
+    BOOST_TEST(testing::equals(vectorData->values(), expectedVector));
+    BOOST_TEST(testing::equals(otherData->values(), Eigen::Vector3d(9.0, 10.0, 11.0)));
+    returnData->values() << 12.0, 13.0;
+    cplScheme.addComputedTime(1.0);
+    cplScheme.advance();
+  }
+  BOOST_TEST(not cplScheme.isCouplingOngoing());
+  cplScheme.finalize();
+}
+
 /// Test that runs on 2 processors.
 BOOST_AUTO_TEST_CASE(testConfiguredSimpleExplicitCoupling)
 {
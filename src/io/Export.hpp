@@ -21,6 +21,15 @@ public:
   /// Returns the export type ID.
   virtual int getType() const = 0;
 
+  /// Returns true, if doExport() communicates between the ranks and has to be called by the solver thread.
+  virtual bool isCollective() const
+  {
+    return false;
+  }
+
+  /// Sets the simulation time of the following exports, which is used by exports of time series.
+  virtual void setTime(double /*time*/) {}
+
   /**
    * @brief Does export. Has to be implemented in subclass.
    *
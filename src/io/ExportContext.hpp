@@ -26,6 +26,9 @@ struct ExportContext {
   // @brief If true, normals are plotted.
   bool plotNormals;
 
+  // @brief Encoding of the exported data (e.g. ascii).
+  std::string format;
+
   /**
    * @brief Constructor.
    */
@@ -35,7 +38,8 @@ struct ExportContext {
         everyNTimeWindows(-1),
         everyIteration(false),
         type(),
-        plotNormals(false) {}
+        plotNormals(false),
+        format("ascii") {}
 };
 
 } // namespace io
@@ -0,0 +1,99 @@
+#include "io/ExportQueue.hpp"
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace io {
+
+ExportQueue::ExportQueue(std::size_t capacity)
+    : _capacity(capacity)
+{
+  PRECICE_ASSERT(capacity >= 1, capacity);
+  _worker = std::thread(&ExportQueue::work, this);
+}
+
+ExportQueue::~ExportQueue()
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return _pending.empty(); });
+    _stop = true;
+  }
+  _condition.notify_all();
+  _worker.join();
+  if (_error) {
+    PRECICE_WARN("An asynchronous export failed and was discarded.");
+  }
+}
+
+void ExportQueue::push(std::function<void()> task)
+{
+  PRECICE_TRACE(_pending.size());
+  std::unique_lock<std::mutex> lock(_mutex);
+  _condition.wait(lock, [this] { return _pending.size() < _capacity; });
+  collect(lock);
+  _pending.push_back(std::move(task));
+  lock.unlock();
+  _condition.notify_all();
+}
+
+void ExportQueue::flush()
+{
+  PRECICE_TRACE(_pending.size());
+  std::unique_lock<std::mutex> lock(_mutex);
+  _condition.wait(lock, [this] { return _pending.empty(); });
+  collect(lock);
+}
+
+std::size_t ExportQueue::getCapacity() const
+{
+  return _capacity;
+}
+
+void ExportQueue::collect(std::unique_lock<std::mutex> &lock)
+{
+  PRECICE_ASSERT(lock.owns_lock());
+  std::vector<std::function<void()>> finished;
+  std::swap(finished, _finished);
+  std::exception_ptr error;
+  std::swap(error, _error);
+
+  lock.unlock();
+  finished.clear();
+  lock.lock();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ExportQueue::work()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _condition.wait(lock, [this] { return _stop || not _pending.empty(); });
+    if (_pending.empty()) {
+      return;
+    }
+    // References to the front stay valid while the calling thread appends to the queue
+    auto &task = _pending.front();
+    if (not _error) {
+      lock.unlock();
+      try {
+        task();
+      } catch (...) {
+        lock.lock();
+        _error = std::current_exception();
+        lock.unlock();
+      }
+      lock.lock();
+    }
+    _finished.push_back(std::move(task));
+    _pending.pop_front();
+    _condition.notify_all();
+  }
+}
+
+} // namespace io
+} // namespace precice
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Writes exports on a background thread, such that file-system latency does not block the solver.
+ *
+ * Tasks are executed one after another in the order in which they were pushed.
+ * They must only access data, which is not modified by the calling thread, i.e., snapshots of meshes and data.
+ *
+ * At most capacity tasks are pending. Pushing to a full queue blocks until the oldest task finished,
+ * which limits the amount of snapshots kept alive. Finished tasks are destroyed by the calling thread,
+ * as destroying snapshots (e.g. meshes) may touch global state such as the spatial index cache.
+ *
+ * Exceptions thrown by a task are rethrown by the next call to push() or flush(). Tasks, which are still
+ * pending when a task fails, are discarded.
+ */
+class ExportQueue {
+public:
+  /// Starts the background thread.
+  explicit ExportQueue(std::size_t capacity);
+
+  ExportQueue(const ExportQueue &) = delete;
+  ExportQueue &operator=(const ExportQueue &) = delete;
+
+  /// Waits for all pending tasks and joins the background thread.
+  ~ExportQueue();
+
+  /// Queues the task, blocks while the queue is full.
+  void push(std::function<void()> task);
+
+  /// Blocks until all pending tasks are finished.
+  void flush();
+
+  /// Returns the maximal amount of pending tasks.
+  std::size_t getCapacity() const;
+
+private:
+  /// Main loop of the background thread.
+  void work();
+
+  /// Destroys finished tasks and rethrows the error of a failed task. The lock must be held.
+  void collect(std::unique_lock<std::mutex> &lock);
+
+  logging::Logger _log{"io::ExportQueue"};
+
+  std::size_t _capacity;
+
+  /// Tasks to execute, the front is the task currently executed.
+  std::deque<std::function<void()>> _pending;
+
+  /// Executed tasks, which are destroyed by the calling thread.
+  std::vector<std::function<void()>> _finished;
+
+  std::exception_ptr _error;
+
+  std::mutex _mutex;
+
+  /// Signals new tasks to the background thread and finished tasks to the calling thread.
+  std::condition_variable _condition;
+
+  bool _stop = false;
+
+  std::thread _worker;
+};
+
+} // namespace io
+} // namespace precice
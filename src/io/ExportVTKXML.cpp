@@ -2,6 +2,7 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <boost/filesystem.hpp>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -18,15 +19,32 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
+
 namespace precice {
 namespace io {
 
+namespace {
+/// Appends a header entry of the appended data section, which are of type UInt64
+void appendHeader(std::string &appendedData, std::uint64_t value)
+{
+  appendedData.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+} // namespace
+
 ExportVTKXML::ExportVTKXML(
-    bool writeNormals)
+    bool   writeNormals,
+    Format format)
     : Export(),
       _writeNormals(writeNormals),
+      _format(format),
       _meshDimensions(-1)
 {
+#ifdef PRECICE_NO_ZLIB
+  PRECICE_ASSERT(_format != Format::Compressed, "Compressed exports require zlib.");
+#endif
 }
 
 int ExportVTKXML::getType() const
@@ -148,22 +166,43 @@ void ExportVTKXML::writeSubFile(
   namespace fs = boost::filesystem;
   fs::path outfile(location);
   outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::getRank()) + ".vtu");
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc | std::ios::binary);
 
   PRECICE_CHECK(outSubFile, "VTKXML export failed to open slave file \"" << outfile << '"');
 
+  _appendedData.clear();
+
   outSubFile << "<?xml version=\"1.0\"?>\n";
   outSubFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
+  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\"" : "LittleEndian\"");
+  if (_format != Format::ASCII) {
+    outSubFile << " header_type=\"UInt64\"";
+  }
+  if (_format == Format::Compressed) {
+    outSubFile << " compressor=\"vtkZLibDataCompressor\"";
+  }
+  outSubFile << ">\n";
 
   outSubFile << "   <UnstructuredGrid>\n";
   outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> \n";
   outSubFile << "         <Points> \n";
-  outSubFile << "            <DataArray type=\"Float64\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> \n";
-  for (const mesh::Vertex &vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outSubFile);
+  if (_format == Format::ASCII) {
+    outSubFile << "            <DataArray type=\"Float64\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> \n";
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      writeVertex(vertex.getCoords(), outSubFile);
+    }
+    outSubFile << "            </DataArray>\n";
+  } else {
+    std::vector<double> positions;
+    positions.reserve(3 * numPoints);
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      const auto coords = vertex.getCoords();
+      for (int i = 0; i < 3; i++) {
+        positions.push_back(i < coords.size() ? coords[i] : 0.0); //also for 2D scenario, vtk needs 3D data
+      }
+    }
+    writeAppendedDataArray(outSubFile, "Float64", "Position", 3, positions);
   }
-  outSubFile << "            </DataArray>\n";
   outSubFile << "         </Points> \n\n";
 
   // Write Mesh
@@ -174,6 +213,12 @@ void ExportVTKXML::writeSubFile(
 
   outSubFile << "      </Piece>\n";
   outSubFile << "   </UnstructuredGrid> \n";
+  if (_format != Format::ASCII) {
+    outSubFile << "   <AppendedData encoding=\"raw\">\n_";
+    outSubFile.write(_appendedData.data(), _appendedData.size());
+    outSubFile << "\n   </AppendedData>\n";
+    _appendedData.clear();
+  }
   outSubFile << "</VTKFile>\n";
 
   outSubFile.close();
@@ -183,6 +228,39 @@ void ExportVTKXML::exportMesh(
     std::ofstream &   outFile,
     mesh::Mesh const &mesh)
 {
+  if (_format != Format::ASCII) {
+    const int         verticesPerCell = (_meshDimensions == 2) ? 2 : 3;
+    const std::size_t numCells        = (_meshDimensions == 2) ? mesh.edges().size() : mesh.triangles().size();
+
+    std::vector<std::int32_t> connectivity;
+    connectivity.reserve(verticesPerCell * numCells);
+    if (_meshDimensions == 2) {
+      for (const mesh::Edge &edge : mesh.edges()) {
+        connectivity.push_back(edge.vertex(0).getID());
+        connectivity.push_back(edge.vertex(1).getID());
+      }
+    } else {
+      for (const mesh::Triangle &triangle : mesh.triangles()) {
+        connectivity.push_back(triangle.vertex(0).getID());
+        connectivity.push_back(triangle.vertex(1).getID());
+        connectivity.push_back(triangle.vertex(2).getID());
+      }
+    }
+    std::vector<std::int32_t> offsets(numCells);
+    for (std::size_t i = 0; i < numCells; i++) {
+      offsets[i] = verticesPerCell * (i + 1);
+    }
+    // VTK_LINE is 3, VTK_TRIANGLE is 5
+    const std::vector<std::uint8_t> types(numCells, (_meshDimensions == 2) ? 3 : 5);
+
+    outFile << "         <Cells>\n";
+    writeAppendedDataArray(outFile, "Int32", "connectivity", 1, connectivity);
+    writeAppendedDataArray(outFile, "Int32", "offsets", 1, offsets);
+    writeAppendedDataArray(outFile, "UInt8", "types", 1, types);
+    outFile << "         </Cells>\n";
+    return;
+  }
+
   if (_meshDimensions == 2) { // write edges as cells
     outFile << "         <Cells>\n";
     outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
@@ -249,6 +327,41 @@ void ExportVTKXML::exportData(
   }
   outFile << "\">\n";
 
+  if (_format != Format::ASCII) {
+    const std::size_t numPoints = mesh.vertices().size();
+    if (_writeNormals) {
+      const auto          dimensions = mesh.getDimensions();
+      std::vector<double> normals;
+      normals.reserve(3 * numPoints);
+      for (const auto &vertex : mesh.vertices()) {
+        const auto normal = vertex.getNormal();
+        for (int i = 0; i < 3; i++) {
+          normals.push_back(i < dimensions ? normal[i] : 0.0);
+        }
+      }
+      writeAppendedDataArray(outFile, "Float64", "VertexNormals", std::max(3, dimensions), normals);
+    }
+    for (mesh::PtrData data : mesh.data()) {
+      const Eigen::VectorXd &values         = data->values();
+      const int              dataDimensions = data->getDimensions();
+      if (dataDimensions == 2) { //2D data needs to be 3D for vtk
+        std::vector<double> padded;
+        padded.reserve(3 * numPoints);
+        for (std::size_t count = 0; count < numPoints; count++) {
+          padded.push_back(values(2 * count));
+          padded.push_back(values(2 * count + 1));
+          padded.push_back(0.0);
+        }
+        writeAppendedDataArray(outFile, "Float64", data->getName(), 3, padded);
+      } else {
+        const std::vector<double> copy(values.data(), values.data() + dataDimensions * numPoints);
+        writeAppendedDataArray(outFile, "Float64", data->getName(), dataDimensions, copy);
+      }
+    }
+    outFile << "         </PointData> \n";
+    return;
+  }
+
   // Print VertexNormals
   if (_writeNormals) {
     const auto dimensions = mesh.getDimensions();
@@ -303,6 +416,53 @@ void ExportVTKXML::exportData(
   outFile << "         </PointData> \n";
 }
 
+template <typename T>
+void ExportVTKXML::writeAppendedDataArray(
+    std::ofstream &       outFile,
+    const std::string &   type,
+    const std::string &   name,
+    int                   components,
+    const std::vector<T> &values)
+{
+  PRECICE_ASSERT(_format != Format::ASCII);
+  outFile << "            <DataArray type=\"" << type << "\" Name=\"" << name << "\" NumberOfComponents=\"" << components;
+  outFile << "\" format=\"appended\" offset=\"" << _appendedData.size() << "\"/>\n";
+
+  const char *        bytes    = reinterpret_cast<const char *>(values.data());
+  const std::uint64_t numBytes = values.size() * sizeof(T);
+
+  if (_format == Format::Binary) {
+    // Header: number of bytes
+    appendHeader(_appendedData, numBytes);
+    _appendedData.append(bytes, numBytes);
+    return;
+  }
+
+  if (numBytes == 0) {
+    // Header: no blocks, block size, size of the last block
+    appendHeader(_appendedData, 0);
+    appendHeader(_appendedData, 0);
+    appendHeader(_appendedData, 0);
+    return;
+  }
+
+#ifndef PRECICE_NO_ZLIB
+  // The whole array is compressed as a single block
+  uLongf      compressedSize = compressBound(numBytes);
+  std::string compressed(compressedSize, '\0');
+  const int   status = compress2(reinterpret_cast<Bytef *>(&compressed[0]), &compressedSize,
+                               reinterpret_cast<const Bytef *>(bytes), numBytes, Z_BEST_SPEED);
+  PRECICE_CHECK(status == Z_OK, "VTKXML export failed to compress data array \"" << name << "\" (zlib error " << status << ')');
+
+  // Header: number of blocks, block size, size of the last block, compressed size of each block
+  appendHeader(_appendedData, 1);
+  appendHeader(_appendedData, numBytes);
+  appendHeader(_appendedData, numBytes);
+  appendHeader(_appendedData, compressedSize);
+  _appendedData.append(compressed.data(), compressedSize);
+#endif
+}
+
 void ExportVTKXML::writeVertex(
     const Eigen::VectorXd &position,
     std::ofstream &        outFile)
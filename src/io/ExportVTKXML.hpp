@@ -21,12 +21,20 @@ namespace io {
 /// Writes meshes to xml-vtk files. Only for parallel usage. Serial usage (coupling mode) should still use ExportVTK
 class ExportVTKXML : public Export {
 public:
+  /// Encoding of the DataArrays in the sub files
+  enum class Format {
+    ASCII,     ///< Human-readable text
+    Binary,    ///< Raw binary data in the appended data section
+    Compressed ///< zlib-compressed binary data in the appended data section, not available with PRECICE_NO_ZLIB
+  };
+
   /**
    * @brief Standard constructor
    *
    * @param[in] writeNormals write normals to file?
+   * @param[in] format encoding of the DataArrays in the sub files
    */
-  ExportVTKXML(bool writeNormals);
+  ExportVTKXML(bool writeNormals, Format format = Format::ASCII);
 
   /// Returns the VTK type ID.
   virtual int getType() const;
@@ -60,6 +68,12 @@ private:
   /// By default set true: plot vertex normals, false: no normals plotting
   bool _writeNormals;
 
+  /// Encoding of the DataArrays in the sub files
+  Format _format;
+
+  /// Encoded DataArrays of the current sub file, which are written after the XML part for binary formats
+  std::string _appendedData;
+
   /// dimensions of mesh
   int _meshDimensions;
 
@@ -98,6 +112,17 @@ private:
   void exportData(
       std::ofstream &outFile,
       mesh::Mesh &   mesh);
+
+  /**
+    * @brief Writes a DataArray, which references the appended data section, and encodes its values there
+    */
+  template <typename T>
+  void writeAppendedDataArray(
+      std::ofstream &       outFile,
+      const std::string &   type,
+      const std::string &   name,
+      int                   components,
+      const std::vector<T> &values);
 };
 
 } // namespace io
@@ -0,0 +1,276 @@
+#ifndef PRECICE_NO_MPI
+
+#include "ExportXDMF.hpp"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mpi.h>
+#include <sstream>
+#include <utility>
+#include "Constants.hpp"
+#include "logging/LogMacros.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Helpers.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace io {
+
+namespace {
+/// Collectively writes the local rows of a distributed array, which starts at itemOffset in the file
+template <typename T>
+void writeRows(
+    MPI_File              file,
+    MPI_Datatype          type,
+    std::uint64_t         itemOffset,
+    int                   columns,
+    std::uint64_t         firstRow,
+    const std::vector<T> &values)
+{
+  const MPI_Offset offset = itemOffset + firstRow * columns * sizeof(T);
+  MPI_File_write_at_all(file, offset, values.data(), values.size(), type, MPI_STATUS_IGNORE);
+}
+
+/// Returns the XDMF DataItem referencing the array in the binary file
+std::string describeItem(std::uint64_t offset, std::uint64_t rows, int columns, bool isInteger, const std::string &file)
+{
+  std::ostringstream item;
+  item << "<DataItem Format=\"Binary\" Endian=\"" << (utils::isMachineBigEndian() ? "Big" : "Little")
+       << "\" Seek=\"" << offset << "\" NumberType=\"" << (isInteger ? "Int\" Precision=\"4" : "Float\" Precision=\"8")
+       << "\" Dimensions=\"" << rows << ' ' << columns << "\">" << file << "</DataItem>";
+  return item.str();
+}
+} // namespace
+
+ExportXDMF::ExportXDMF(
+    bool writeNormals)
+    : Export(),
+      _writeNormals(writeNormals)
+{
+}
+
+int ExportXDMF::getType() const
+{
+  return constants::exportXDMF();
+}
+
+bool ExportXDMF::isCollective() const
+{
+  return true;
+}
+
+void ExportXDMF::setTime(double time)
+{
+  _time = time;
+}
+
+void ExportXDMF::doExport(
+    const std::string &name,
+    const std::string &location,
+    mesh::Mesh &       mesh)
+{
+  PRECICE_TRACE(name, location, mesh.getName());
+  namespace fs = boost::filesystem;
+
+  const bool     isParallel = utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave();
+  const MPI_Comm comm       = isParallel ? utils::Parallel::current()->comm : MPI_COMM_SELF;
+  const int      rank       = isParallel ? utils::MasterSlave::getRank() : 0;
+
+  // Vertices of each rank are stored contiguously in the order of the ranks
+  const auto &vertexOffsets = mesh.getVertexOffsets();
+  PRECICE_ASSERT(vertexOffsets.size() == static_cast<std::size_t>(isParallel ? utils::MasterSlave::getSize() : 1),
+                 vertexOffsets.size());
+  const std::uint64_t globalVertices = vertexOffsets.back();
+  const std::uint64_t firstVertex    = (rank == 0) ? 0 : vertexOffsets[rank - 1];
+  PRECICE_ASSERT(vertexOffsets[rank] - firstVertex == mesh.vertices().size());
+  if (globalVertices == 0) {
+    PRECICE_DEBUG("Skipping export of empty mesh \"" << mesh.getName() << '"');
+    return;
+  }
+
+  // Edges are the cells of 2D meshes, triangles the cells of 3D meshes
+  const int        dimensions = mesh.getDimensions();
+  int              cellSize   = (dimensions == 2) ? 2 : 3;
+  std::vector<int> connectivity;
+  if (dimensions == 2) {
+    for (const mesh::Edge &edge : mesh.edges()) {
+      connectivity.push_back(firstVertex + edge.vertex(0).getID());
+      connectivity.push_back(firstVertex + edge.vertex(1).getID());
+    }
+  } else {
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      connectivity.push_back(firstVertex + triangle.vertex(0).getID());
+      connectivity.push_back(firstVertex + triangle.vertex(1).getID());
+      connectivity.push_back(firstVertex + triangle.vertex(2).getID());
+    }
+  }
+  unsigned long long localCells  = connectivity.size() / cellSize;
+  unsigned long long globalCells = 0;
+  MPI_Allreduce(&localCells, &globalCells, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+  if (globalCells == 0) {
+    // Meshes without connectivity are written as point clouds
+    cellSize = 1;
+    connectivity.resize(mesh.vertices().size());
+    for (std::size_t i = 0; i < connectivity.size(); ++i) {
+      connectivity[i] = firstVertex + i;
+    }
+    localCells  = connectivity.size();
+    globalCells = globalVertices;
+  }
+  unsigned long long firstCell = 0;
+  MPI_Exscan(&localCells, &firstCell, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+  if (rank == 0) {
+    firstCell = 0; // the result of MPI_Exscan is undefined on the first rank
+  }
+
+  const auto     suffix   = name.rfind('.');
+  const fs::path basePath = fs::path(location) / fs::path(name.substr(0, suffix));
+  Series &       series   = _series[basePath.string()];
+  const bool     isNew    = series.steps.empty();
+
+  std::vector<double> positions;
+  positions.reserve(3 * mesh.vertices().size());
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    const auto &coords = vertex.getCoords();
+    for (int i = 0; i < 3; i++) {
+      positions.push_back(i < dimensions ? coords[i] : 0.0);
+    }
+  }
+
+  // Moving vertices keeps their amount, hence the coordinates are compared
+  int changed = isNew || series.positions != positions || series.connectivity != connectivity;
+  MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_LOR, comm);
+
+  if (isNew && not location.empty()) {
+    fs::create_directories(location);
+  }
+  const std::string binaryPath = basePath.string() + ".bin";
+  MPI_File          file;
+  int               status = MPI_File_open(comm, const_cast<char *>(binaryPath.c_str()), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file);
+  PRECICE_CHECK(status == MPI_SUCCESS, "XDMF export failed to open binary file \"" << binaryPath << '"');
+  if (isNew) {
+    MPI_File_set_size(file, 0);
+  }
+
+  Step step;
+  step.name = (suffix == std::string::npos) ? name : name.substr(suffix + 1);
+  step.time = _time;
+
+  if (changed) {
+    PRECICE_DEBUG("Writing geometry of mesh \"" << mesh.getName() << '"');
+    Geometry geometry;
+    geometry.positions = {series.size, globalVertices, 3};
+    series.size += globalVertices * 3 * sizeof(double);
+    geometry.connectivity = {series.size, globalCells, cellSize};
+    series.size += globalCells * cellSize * sizeof(int);
+
+    writeRows(file, MPI_DOUBLE, geometry.positions.offset, 3, firstVertex, positions);
+    writeRows(file, MPI_INT, geometry.connectivity.offset, cellSize, firstCell, connectivity);
+
+    series.geometries.push_back(geometry);
+    series.positions    = std::move(positions);
+    series.connectivity = std::move(connectivity);
+  }
+  step.geometry = series.geometries.size() - 1;
+
+  // Vector data is padded to three components
+  auto writeAttribute = [&](const std::string &attributeName, const std::vector<double> &values, int columns) {
+    DataItem item{series.size, globalVertices, columns};
+    series.size += globalVertices * columns * sizeof(double);
+    writeRows(file, MPI_DOUBLE, item.offset, columns, firstVertex, values);
+    step.attributes.emplace_back(attributeName, item);
+  };
+
+  if (_writeNormals) {
+    std::vector<double> normals;
+    normals.reserve(3 * mesh.vertices().size());
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      const auto &normal = vertex.getNormal();
+      for (int i = 0; i < 3; i++) {
+        normals.push_back(i < dimensions ? normal[i] : 0.0);
+      }
+    }
+    writeAttribute("VertexNormals", normals, 3);
+  }
+  for (const mesh::PtrData &data : mesh.data()) {
+    const Eigen::VectorXd &values         = data->values();
+    const int              dataDimensions = data->getDimensions();
+    const int              columns        = (dataDimensions == 1) ? 1 : 3;
+    std::vector<double>    padded;
+    padded.reserve(columns * mesh.vertices().size());
+    for (std::size_t i = 0; i < mesh.vertices().size(); i++) {
+      for (int d = 0; d < columns; d++) {
+        padded.push_back(d < dataDimensions ? values(i * dataDimensions + d) : 0.0);
+      }
+    }
+    writeAttribute(data->getName(), padded, columns);
+  }
+
+  MPI_File_close(&file);
+  series.steps.push_back(std::move(step));
+
+  if (rank == 0) {
+    writeDescription(basePath.string(), series);
+  }
+}
+
+void ExportXDMF::writeDescription(
+    const std::string &path,
+    const Series &     series)
+{
+  const std::string descriptionPath = path + ".xmf";
+  const std::string binaryFile      = boost::filesystem::path(path + ".bin").filename().string();
+  std::ofstream     outFile(descriptionPath, std::ios::trunc);
+  PRECICE_CHECK(outFile, "XDMF export failed to open file \"" << descriptionPath << '"');
+  outFile << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  outFile << "<?xml version=\"1.0\"?>\n";
+  outFile << "<Xdmf Version=\"3.0\">\n";
+  outFile << "  <Domain>\n";
+  outFile << "    <Grid Name=\"" << boost::filesystem::path(path).filename().string() << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  for (std::size_t i = 0; i < series.steps.size(); ++i) {
+    const Step &    step     = series.steps[i];
+    const Geometry &geometry = series.geometries[step.geometry];
+    const auto &    cells    = geometry.connectivity;
+
+    outFile << "      <Grid Name=\"" << step.name << "\" GridType=\"Uniform\">\n";
+    outFile << "        <Time Value=\"" << step.time << "\"/>\n";
+    outFile << "        <Topology TopologyType=\"";
+    if (cells.columns == 1) {
+      outFile << "Polyvertex\" NodesPerElement=\"1";
+    } else if (cells.columns == 2) {
+      outFile << "Polyline\" NodesPerElement=\"2";
+    } else {
+      outFile << "Triangle";
+    }
+    outFile << "\" NumberOfElements=\"" << cells.rows << "\">\n";
+    outFile << "          " << describeItem(cells.offset, cells.rows, cells.columns, true, binaryFile) << '\n';
+    outFile << "        </Topology>\n";
+    outFile << "        <Geometry GeometryType=\"XYZ\">\n";
+    outFile << "          " << describeItem(geometry.positions.offset, geometry.positions.rows, 3, false, binaryFile) << '\n';
+    outFile << "        </Geometry>\n";
+    for (const auto &attribute : step.attributes) {
+      const DataItem &item = attribute.second;
+      outFile << "        <Attribute Name=\"" << attribute.first << "\" AttributeType=\"" << (item.columns == 1 ? "Scalar" : "Vector") << "\" Center=\"Node\">\n";
+      outFile << "          " << describeItem(item.offset, item.rows, item.columns, false, binaryFile) << '\n';
+      outFile << "        </Attribute>\n";
+    }
+    outFile << "      </Grid>\n";
+  }
+  outFile << "    </Grid>\n";
+  outFile << "  </Domain>\n";
+  outFile << "</Xdmf>\n";
+}
+
+} // namespace io
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
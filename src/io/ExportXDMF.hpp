@@ -0,0 +1,132 @@
+#pragma once
+#ifndef PRECICE_NO_MPI
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Export.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mesh {
+class Mesh;
+} // namespace mesh
+} // namespace precice
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Writes the partitions of all ranks into one binary file per time series, described by an XDMF file.
+ *
+ * The name of an export consists of the name of the series and a suffix, separated by the last '.',
+ * e.g. "MeshOne-SolverOne.dt5". All exports of a series are appended to the file "<series>.bin", which
+ * is written collectively using MPI-IO. Every rank writes its vertices at the offset given by
+ * Mesh::getVertexOffsets(). The file "<series>.xmf" describes all exports of the series as temporal
+ * collection, which can be read by ParaView. It is rewritten by the first rank after every export.
+ *
+ * The geometry and connectivity are only written again, if the vertex coordinates or cells of any rank changed.
+ * The steps of the temporal collection are placed at the simulation time given by setTime().
+ */
+class ExportXDMF : public Export {
+public:
+  /**
+   * @brief Standard constructor
+   *
+   * @param[in] writeNormals write normals to file?
+   */
+  ExportXDMF(bool writeNormals);
+
+  /// Returns the XDMF type ID.
+  virtual int getType() const;
+
+  /// Communicates between all ranks of the participant.
+  virtual bool isCollective() const;
+
+  /// Sets the time of the following steps.
+  virtual void setTime(double time);
+
+  /**
+   * @brief Appends the mesh and its data to the files of the series
+   *
+   * @param[in] name Name of the series and the export, separated by the last '.'
+   * @param[in] location Export path
+   * @param[in] mesh Mesh to export
+   */
+  virtual void doExport(
+      const std::string &name,
+      const std::string &location,
+      mesh::Mesh &       mesh);
+
+private:
+  /// A distributed array in the binary file
+  struct DataItem {
+    /// Offset in the binary file in bytes
+    std::uint64_t offset;
+
+    /// Global amount of rows
+    std::uint64_t rows;
+
+    /// Amount of values per row
+    int columns;
+  };
+
+  /// Vertex coordinates and cells shared by several exports
+  struct Geometry {
+    DataItem positions;
+
+    DataItem connectivity;
+  };
+
+  /// Data of one export
+  struct Step {
+    std::string name;
+
+    /// Simulation time of the step
+    double time;
+
+    /// Index of the geometry of this step in Series::geometries
+    std::size_t geometry;
+
+    std::vector<std::pair<std::string, DataItem>> attributes;
+  };
+
+  /// All exports written to the same pair of files
+  struct Series {
+    /// Size of the binary file in bytes
+    std::uint64_t size = 0;
+
+    std::vector<Geometry> geometries;
+
+    std::vector<Step> steps;
+
+    /// Local vertex coordinates of the latest geometry, padded to three components
+    std::vector<double> positions;
+
+    /// Local cells of the latest geometry
+    std::vector<int> connectivity;
+  };
+
+  logging::Logger _log{"io::ExportXDMF"};
+
+  /// By default set true: plot vertex normals, false: no normals plotting
+  bool _writeNormals;
+
+  /// Simulation time of the following exports
+  double _time = 0.0;
+
+  /// Series by the path of their files without extension
+  std::map<std::string, Series> _series;
+
+  /// Writes the XDMF file of the series
+  void writeDescription(
+      const std::string &path,
+      const Series &     series);
+};
+
+} // namespace io
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
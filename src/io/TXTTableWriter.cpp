@@ -1,6 +1,7 @@
 #include "TXTTableWriter.hpp"
 #include <algorithm>
 #include <iomanip>
+#include "io/ExportQueue.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/assertion.hpp"
@@ -20,29 +21,42 @@ TXTTableWriter::TXTTableWriter(
   _outputStream.setf(std::ios::showpoint);
   _outputStream.setf(std::ios::fixed);
   _outputStream << std::setprecision(16);
+  _buffer.setf(std::ios::showpoint);
+  _buffer.setf(std::ios::fixed);
+  _buffer << std::setprecision(16);
+}
+
+void TXTTableWriter::setExportQueue(ExportQueue *queue)
+{
+  _queue = queue;
 }
 
 void TXTTableWriter::addData(
     const std::string &name,
     DataType           type)
 {
-  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(_queue || _outputStream);
   Data data;
   data.name = name;
   data.type = type;
   _data.push_back(data);
   if ((type == INT) || (type == DOUBLE)) {
-    _outputStream << name << "  ";
+    _buffer << name << "  ";
   } else if (type == VECTOR2D) {
     for (int i = 0; i < 2; i++) {
-      _outputStream << name << i << "  ";
+      _buffer << name << i << "  ";
     }
   } else {
     PRECICE_ASSERT(type == VECTOR3D);
     for (int i = 0; i < 3; i++) {
-      _outputStream << name << i << "  ";
+      _buffer << name << i << "  ";
     }
   }
+  if (not _queue) {
+    // Written without flushing, with a queue the header is written with the first row
+    _outputStream << _buffer.str();
+    _buffer.str("");
+  }
   _writeIterator = _data.end();
 }
 
@@ -50,18 +64,18 @@ void TXTTableWriter::writeData(
     const std::string &name,
     int                value)
 {
-  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(_queue || _outputStream);
   PRECICE_ASSERT(not _data.empty());
   if (_writeIterator == _data.end()) {
     _writeIterator = _data.begin();
-    _outputStream << "\n";
+    _buffer << "\n";
   }
   PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
   PRECICE_ASSERT(_writeIterator->type == INT, _writeIterator->type);
-  _outputStream << value << "  ";
+  _buffer << value << "  ";
   _writeIterator++;
   if (_writeIterator == _data.end()) {
-    _outputStream.flush();
+    writeBuffer();
   }
 }
 
@@ -69,18 +83,18 @@ void TXTTableWriter::writeData(
     const std::string &name,
     double             value)
 {
-  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(_queue || _outputStream);
   PRECICE_ASSERT(not _data.empty());
   if (_writeIterator == _data.end()) {
     _writeIterator = _data.begin();
-    _outputStream << "\n";
+    _buffer << "\n";
   }
   PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
   PRECICE_ASSERT(_writeIterator->type == DOUBLE, _writeIterator->type);
-  _outputStream << value << "  ";
+  _buffer << value << "  ";
   _writeIterator++;
   if (_writeIterator == _data.end()) {
-    _outputStream.flush();
+    writeBuffer();
   }
 }
 
@@ -88,20 +102,20 @@ void TXTTableWriter::writeData(
     const std::string &    name,
     const Eigen::Vector2d &value)
 {
-  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(_queue || _outputStream);
   PRECICE_ASSERT(not _data.empty());
   if (_writeIterator == _data.end()) {
     _writeIterator = _data.begin();
-    _outputStream << "\n";
+    _buffer << "\n";
   }
   PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
   PRECICE_ASSERT(_writeIterator->type == VECTOR2D, _writeIterator->type);
   for (int i = 0; i < value.size(); i++) {
-    _outputStream << value[i] << "  ";
+    _buffer << value[i] << "  ";
   }
   _writeIterator++;
   if (_writeIterator == _data.end()) {
-    _outputStream.flush();
+    writeBuffer();
   }
 }
 
@@ -109,25 +123,43 @@ void TXTTableWriter::writeData(
     const std::string &    name,
     const Eigen::Vector3d &value)
 {
-  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(_queue || _outputStream);
   PRECICE_ASSERT(not _data.empty());
   if (_writeIterator == _data.end()) {
     _writeIterator = _data.begin();
-    _outputStream << "\n";
+    _buffer << "\n";
   }
   PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
   PRECICE_ASSERT(_writeIterator->type == VECTOR3D, _writeIterator->type);
   for (int i = 0; i < value.size(); i++) {
-    _outputStream << value[i] << "  ";
+    _buffer << value[i] << "  ";
   }
   _writeIterator++;
   if (_writeIterator == _data.end()) {
+    writeBuffer();
+  }
+}
+
+void TXTTableWriter::writeBuffer()
+{
+  std::string text = _buffer.str();
+  _buffer.str("");
+  if (_queue) {
+    _queue->push([this, text] {
+      _outputStream << text;
+      _outputStream.flush();
+    });
+  } else {
+    _outputStream << text;
     _outputStream.flush();
   }
 }
 
 void TXTTableWriter::close()
 {
+  if (_queue) {
+    _queue->flush();
+  }
   PRECICE_ASSERT(_outputStream.is_open());
   _outputStream.close();
 }
@@ -2,12 +2,14 @@
 
 #include <Eigen/Core>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include "logging/Logger.hpp"
 
 namespace precice {
 namespace io {
+class ExportQueue;
 
 /**
  * @brief File writer for table-data in text-format.
@@ -29,6 +31,13 @@ public:
   /// Constructor, opens file.
   explicit TXTTableWriter(const std::string &filename);
 
+  /**
+   * @brief Writes completed rows through the given queue, i.e., on its background thread.
+   *
+   * Passing nullptr writes rows directly again. The queue has to outlive the writer.
+   */
+  void setExportQueue(ExportQueue *queue);
+
   /**
    * @brief Adds a data entry to the table.
    *
@@ -98,6 +107,15 @@ private:
   std::vector<Data>::const_iterator _writeIterator;
 
   std::ofstream _outputStream;
+
+  /// Holds the current row until it is complete
+  std::ostringstream _buffer;
+
+  /// Queue used to write completed rows, nullptr to write them directly
+  ExportQueue *_queue = nullptr;
+
+  /// Writes the buffered text to the file and clears the buffer
+  void writeBuffer();
 };
 
 } // namespace io
@@ -1,4 +1,5 @@
 #include "ExportConfiguration.hpp"
+#include "logging/LogMacros.hpp"
 #include "xml/ConfigParser.hpp"
 #include "xml/XMLAttribute.hpp"
 #include "xml/XMLTag.hpp"
@@ -17,6 +18,12 @@ ExportConfiguration::ExportConfiguration(xml::XMLTag &parent)
     tag.setDocumentation("Exports meshes to VTK text files.");
     tags.push_back(tag);
   }
+  {
+    XMLTag tag(*this, VALUE_XDMF, occ, TAG);
+    tag.setDocumentation("Exports meshes of all ranks to one binary file per mesh, which is written using MPI-IO "
+                         "and described by an XDMF file. The geometry is only written again if the mesh changed.");
+    tags.push_back(tag);
+  }
 
   auto attrLocation = XMLAttribute<std::string>(ATTR_LOCATION, "")
                           .setDocumentation("Directory to export the files to.");
@@ -30,11 +37,18 @@ ExportConfiguration::ExportConfiguration(xml::XMLTag &parent)
   auto attrEveryIteration = makeXMLAttribute(ATTR_EVERY_ITERATION, false)
                                 .setDocumentation("Exports in every coupling (sub)iteration. For debug purposes.");
 
+  auto attrFormat = makeXMLAttribute(ATTR_FORMAT, "ascii")
+                        .setOptions({"ascii", "binary", "compressed"})
+                        .setDocumentation("Encoding of the data in parallel (VTU) exports, only used by <export:vtk>. "
+                                          "\"binary\" appends raw binary data, \"compressed\" appends zlib-compressed binary data. "
+                                          "Serial exports are always written as text and only accept \"ascii\".");
+
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrLocation);
     tag.addAttribute(attrEveryNTimeWindows);
     tag.addAttribute(attrNormals);
     tag.addAttribute(attrEveryIteration);
+    tag.addAttribute(attrFormat);
     parent.addSubtag(tag);
   }
 }
@@ -49,7 +63,13 @@ void ExportConfiguration::xmlTagCallback(
     econtext.everyNTimeWindows = tag.getIntAttributeValue(ATTR_EVERY_N_TIME_WINDOWS);
     econtext.plotNormals       = tag.getBooleanAttributeValue(ATTR_NORMALS);
     econtext.everyIteration    = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
+    econtext.format            = tag.getStringAttributeValue(ATTR_FORMAT);
     econtext.type              = tag.getName();
+#ifdef PRECICE_NO_ZLIB
+    PRECICE_CHECK(econtext.format != "compressed",
+                  "The export format \"compressed\" can only be used if preCICE was compiled with zlib support enabled. "
+                  "Either switch to format=\"binary\" or recompile preCICE with \"PRECICE_ZlibCompression=ON\".");
+#endif
     _contexts.push_back(econtext);
   }
 }
@@ -43,11 +43,13 @@ private:
   const std::string ATTR_TYPE     = "type";
   const std::string ATTR_AUTO     = "auto";
   const std::string VALUE_VTK     = "vtk";
+  const std::string VALUE_XDMF    = "xdmf";
 
   const std::string ATTR_EVERY_N_TIME_WINDOWS = "every-n-time-windows";
   const std::string ATTR_NEIGHBORS            = "neighbors";
   const std::string ATTR_NORMALS              = "normals";
   const std::string ATTR_EVERY_ITERATION      = "every-iteration";
+  const std::string ATTR_FORMAT               = "format";
 
   std::list<ExportContext> _contexts;
 };
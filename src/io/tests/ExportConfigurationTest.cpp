@@ -23,7 +23,9 @@ BOOST_AUTO_TEST_CASE(Configuration)
     const io::ExportContext &context = config.exportContexts().front();
     BOOST_TEST(context.type == "vtk");
     BOOST_TEST(context.everyNTimeWindows == 10);
+    BOOST_TEST(context.format == "ascii");
   }
+#ifndef PRECICE_NO_ZLIB
   {
     tag.clear();
     io::ExportConfiguration config(tag);
@@ -33,7 +35,9 @@ BOOST_AUTO_TEST_CASE(Configuration)
     BOOST_TEST(context.type == "vtk");
     BOOST_TEST(context.everyNTimeWindows == 1);
     BOOST_TEST(context.location == "somepath");
+    BOOST_TEST(context.format == "compressed");
   }
+#endif
 }
 
 BOOST_AUTO_TEST_SUITE_END() // IOTests
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "io/ExportQueue.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+BOOST_AUTO_TEST_SUITE(ExportQueueTests)
+
+BOOST_AUTO_TEST_CASE(Order)
+{
+  PRECICE_TEST(1_rank);
+  io::ExportQueue  queue(2);
+  std::vector<int> written;
+  for (int i = 0; i < 10; ++i) {
+    queue.push([&written, i] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      written.push_back(i);
+    });
+  }
+  queue.flush();
+  BOOST_TEST(written == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+BOOST_AUTO_TEST_CASE(BackPressure)
+{
+  PRECICE_TEST(1_rank);
+  io::ExportQueue queue(2);
+  BOOST_TEST(queue.getCapacity() == 2);
+  // Each task holds a snapshot, which is alive until the task was destroyed by the calling thread
+  auto snapshot = std::make_shared<int>(0);
+  for (int i = 0; i < 10; ++i) {
+    queue.push([snapshot] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    // The new task, and at most two pending and one finished task, which was not destroyed yet
+    BOOST_TEST(snapshot.use_count() <= 5);
+  }
+  queue.flush();
+  BOOST_TEST(snapshot.use_count() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(Error)
+{
+  PRECICE_TEST(1_rank);
+  io::ExportQueue queue(1);
+  bool            written = false;
+  queue.push([] { throw std::runtime_error("disk full"); });
+  BOOST_CHECK_THROW(queue.flush(), std::runtime_error);
+  // The queue can be used again after the error was reported
+  queue.push([&written] { written = true; });
+  queue.flush();
+  BOOST_TEST(written);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ExportQueueTests
+BOOST_AUTO_TEST_SUITE_END() // IOTests
@@ -2,11 +2,16 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
 #include "com/SharedPointer.hpp"
 #include "io/Export.hpp"
 #include "io/ExportVTKXML.hpp"
+#include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
@@ -136,6 +141,83 @@ BOOST_AUTO_TEST_CASE(ExportTriangulatedMesh)
   exportVTKXML.doExport(filename, location, mesh);
 }
 
+namespace {
+/// Creates a triangle on rank 0 and a single vertex on rank 1 and returns the contents of the sub file of rank 0
+std::string exportTriangle(io::ExportVTKXML::Format format, const std::string &filename)
+{
+  int        dim           = 3;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals, testing::nextMeshID());
+  mesh::PtrData data = mesh.createData("Forces", dim);
+
+  if (utils::Parallel::getProcessRank() == 0) {
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+    mesh::Vertex &v3 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+
+    mesh.getVertexDistribution()[0] = {0, 1, 2};
+    mesh.getVertexDistribution()[1] = {3};
+  } else {
+    mesh.createVertex(Eigen::Vector3d::Constant(3.0));
+  }
+  mesh.allocateDataValues();
+  data->values().setLinSpaced(data->values().size(), 0.0, 1.0);
+  mesh.computeState();
+
+  bool             exportNormals = true;
+  io::ExportVTKXML exportVTKXML(exportNormals, format);
+  exportVTKXML.doExport(filename, "", mesh);
+
+  if (utils::Parallel::getProcessRank() != 0) {
+    return {};
+  }
+  std::ifstream file(filename + "_r0.vtu", std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ExportBinary)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  const std::string content = exportTriangle(io::ExportVTKXML::Format::Binary, "io-ExportVTKXMLTest-testExportBinary");
+  if (context.isMaster()) {
+    BOOST_TEST(content.find("header_type=\"UInt64\"") != std::string::npos);
+    BOOST_TEST(content.find("format=\"ascii\"") == std::string::npos);
+
+    // The positions are the first array of the appended data
+    BOOST_TEST(content.find("Name=\"Position\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"") != std::string::npos);
+    const auto begin = content.find("<AppendedData encoding=\"raw\">\n_");
+    BOOST_TEST_REQUIRE(begin != std::string::npos);
+    const char *raw = content.data() + begin + std::strlen("<AppendedData encoding=\"raw\">\n_");
+
+    std::uint64_t numBytes;
+    std::memcpy(&numBytes, raw, sizeof(numBytes));
+    BOOST_TEST(numBytes == 9 * sizeof(double));
+    double positions[9];
+    std::memcpy(positions, raw + sizeof(numBytes), sizeof(positions));
+    const double expected[9] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+    BOOST_TEST(std::equal(std::begin(positions), std::end(positions), std::begin(expected)));
+  }
+}
+
+#ifndef PRECICE_NO_ZLIB
+BOOST_AUTO_TEST_CASE(ExportCompressed)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  const std::string content = exportTriangle(io::ExportVTKXML::Format::Compressed, "io-ExportVTKXMLTest-testExportCompressed");
+  if (context.isMaster()) {
+    BOOST_TEST(content.find("compressor=\"vtkZLibDataCompressor\"") != std::string::npos);
+    BOOST_TEST(content.find("Name=\"Forces\" NumberOfComponents=\"3\" format=\"appended\"") != std::string::npos);
+    BOOST_TEST(content.find("<AppendedData encoding=\"raw\">") != std::string::npos);
+  }
+}
+#endif // not PRECICE_NO_ZLIB
+
 BOOST_AUTO_TEST_SUITE_END() // IOTests
 BOOST_AUTO_TEST_SUITE_END() // VTKXMLExport
 
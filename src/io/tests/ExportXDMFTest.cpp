@@ -0,0 +1,144 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "io/ExportXDMF.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Parallel.hpp"
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(XDMFExport)
+
+namespace {
+std::string readFile(const std::string &filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+std::size_t count(const std::string &content, const std::string &pattern)
+{
+  std::size_t occurrences = 0;
+  for (auto pos = content.find(pattern); pos != std::string::npos; pos = content.find(pattern, pos + 1)) {
+    ++occurrences;
+  }
+  return occurrences;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ExportSeries)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  int           dim           = 3;
+  bool          invertNormals = false;
+  mesh::Mesh    mesh("MyMesh", dim, invertNormals, testing::nextMeshID());
+  mesh::PtrData data = mesh.createData("Forces", dim);
+
+  if (context.isMaster()) {
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+    mesh::Vertex &v3 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+  } else {
+    mesh.createVertex(Eigen::Vector3d::Constant(3.0));
+  }
+  std::vector<int> vertexOffsets{3, 4};
+  mesh.setVertexOffsets(vertexOffsets);
+  mesh.allocateDataValues();
+  mesh.computeState();
+
+  bool              exportNormals = false;
+  io::ExportXDMF    exportXDMF(exportNormals);
+  const std::string series = "io-ExportXDMFTest-testExportSeries";
+  data->values().setConstant(1.0);
+  exportXDMF.setTime(0.25);
+  exportXDMF.doExport(series + ".dt1", "", mesh);
+  data->values().setConstant(2.0);
+  exportXDMF.setTime(0.5);
+  exportXDMF.doExport(series + ".dt2", "", mesh);
+
+  if (context.isMaster()) {
+    const std::string description = readFile(series + ".xmf");
+    BOOST_TEST(count(description, "GridType=\"Uniform\"") == 2);
+    BOOST_TEST(count(description, "<Grid Name=\"dt2\"") == 1);
+    BOOST_TEST(count(description, "<Time Value=\"0.25\"/>") == 1);
+    BOOST_TEST(count(description, "<Time Value=\"0.5\"/>") == 1);
+    // Both steps share the geometry at the beginning of the file
+    BOOST_TEST(count(description, "Seek=\"0\"") == 2);
+    BOOST_TEST(count(description, "TopologyType=\"Triangle\" NumberOfElements=\"1\"") == 2);
+
+    // Positions (4x3 double), connectivity (1x3 int) and the data of both steps (2x4x3 double)
+    const std::string binary = readFile(series + ".bin");
+    BOOST_TEST_REQUIRE(binary.size() == 12 * sizeof(double) + 3 * sizeof(int) + 24 * sizeof(double));
+
+    double position[3];
+    std::memcpy(position, binary.data() + 9 * sizeof(double), sizeof(position));
+    BOOST_TEST(position[0] == 3.0);
+    BOOST_TEST(position[2] == 3.0);
+
+    double lastValue;
+    std::memcpy(&lastValue, binary.data() + binary.size() - sizeof(double), sizeof(lastValue));
+    BOOST_TEST(lastValue == 2.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ExportMovedVertices)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  int        dim           = 2;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals, testing::nextMeshID());
+
+  mesh::Vertex &vertex = mesh.createVertex(Eigen::Vector2d::Constant(context.rank));
+
+  std::vector<int> vertexOffsets{1, 2};
+  mesh.setVertexOffsets(vertexOffsets);
+  mesh.computeState();
+
+  bool              exportNormals = false;
+  io::ExportXDMF    exportXDMF(exportNormals);
+  const std::string series = "io-ExportXDMFTest-testExportMovedVertices";
+  exportXDMF.doExport(series + ".dt1", "", mesh);
+  // Only the slave moves its vertex, all ranks have to write the new geometry
+  if (not context.isMaster()) {
+    vertex.setCoords(Eigen::Vector2d::Constant(2.0));
+  }
+  exportXDMF.doExport(series + ".dt2", "", mesh);
+  exportXDMF.doExport(series + ".dt3", "", mesh);
+
+  if (context.isMaster()) {
+    const std::string description = readFile(series + ".xmf");
+    BOOST_TEST(count(description, "GridType=\"Uniform\"") == 3);
+    BOOST_TEST(count(description, "Seek=\"0\"") == 1);
+
+    // Two geometries of positions (2x3 double) and connectivity (2x1 int)
+    const std::string binary = readFile(series + ".bin");
+    BOOST_TEST_REQUIRE(binary.size() == 2 * (6 * sizeof(double) + 2 * sizeof(int)));
+
+    double position[3];
+    std::memcpy(position, binary.data() + 6 * sizeof(double) + 2 * sizeof(int) + 3 * sizeof(double), sizeof(position));
+    BOOST_TEST(position[0] == 2.0);
+    BOOST_TEST(position[1] == 2.0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // XDMFExport
+BOOST_AUTO_TEST_SUITE_END() // IOTests
+
+#endif // PRECICE_NO_MPI
@@ -16,10 +16,9 @@
 
 #define PRECICE_INFO(message) _log.info(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message))
 
-#define PRECICE_ERROR(message)                                    \
-  do {                                                            \
-    _log.error(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message)); \
-    std::exit(-1);                                                \
+#define PRECICE_ERROR(message)                                                                \
+  do {                                                                                        \
+    precice::logging::exitWithError(_log, PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message)); \
   } while (false)
 
 #define PRECICE_CHECK(check, message) \
@@ -6,12 +6,18 @@
 #include <boost/log/expressions.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
+#include <cstdlib>
 #include <iosfwd>
 #include <utility>
 
 namespace precice {
 namespace logging {
 
+namespace {
+/// True, if PRECICE_ERROR throws a DeferredError on the current thread
+thread_local bool deferErrors = false;
+} // namespace
+
 /** The implementation of logging::Logger
  *
  * @note The point of using a pimpl for the logger is to remove boost::log from logger.hpp
@@ -119,5 +125,24 @@ void Logger::trace(LogLocation loc, const std::string &mess) noexcept
   }
 }
 
+void setDeferErrors(bool defer)
+{
+  deferErrors = defer;
+}
+
+bool isDeferringErrors()
+{
+  return deferErrors;
+}
+
+void exitWithError(Logger &log, LogLocation loc, const std::string &mess)
+{
+  if (deferErrors) {
+    throw DeferredError{log, loc, mess};
+  }
+  log.error(loc, mess);
+  std::exit(-1);
+}
+
 } // namespace logging
 } // namespace precice
@@ -45,6 +45,27 @@ private:
   std::unique_ptr<LoggerImpl> _impl;
 };
 
+/// Thrown by PRECICE_ERROR instead of exiting, if errors of the thread are deferred
+struct DeferredError {
+  Logger      logger;
+  LogLocation location;
+  std::string message;
+};
+
+/**
+ * @brief Defers errors of the calling thread to another thread.
+ *
+ * Used by threads of the utils::ThreadPool, which must not exit the program while other threads still run the loop.
+ * The thread catching the DeferredError reports it using exitWithError().
+ */
+void setDeferErrors(bool defer);
+
+/// Returns true, if errors of the calling thread are deferred
+bool isDeferringErrors();
+
+/// Logs the error and exits the program, or throws a DeferredError if errors of the calling thread are deferred.
+[[noreturn]] void exitWithError(Logger &log, LogLocation loc, const std::string &mess);
+
 } // namespace logging
 } // namespace precice
 
@@ -104,6 +104,16 @@ public:
    */
   virtual void closeConnection() = 0;
 
+  /**
+   * @brief Returns true, if send() returns without waiting for the remote participant to receive.
+   *
+   * Then, both participants may send at the same time without a deadlock.
+   */
+  virtual bool isSendAsynchronous() const
+  {
+    return false;
+  }
+
   /// Sends an array of double values from all slaves (different for each slave).
   virtual void send(
       double const *itemsToSend,
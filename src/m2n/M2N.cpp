@@ -1,4 +1,5 @@
 #include "M2N.hpp"
+#include <algorithm>
 #include <utility>
 #include "DistributedComFactory.hpp"
 #include "DistributedCommunication.hpp"
@@ -190,6 +191,16 @@ void M2N::createDistributedCommunication(mesh::PtrMesh mesh)
   _distComs[mesh->getID()]                        = distCom;
 }
 
+bool M2N::isSendAsynchronous() const
+{
+  if (_useOnlyMasterCom) {
+    return false;
+  }
+  return std::all_of(_distComs.begin(), _distComs.end(), [](const auto &pair) {
+    return pair.second->isSendAsynchronous();
+  });
+}
+
 void M2N::send(
     double const *itemsToSend,
     int           size,
@@ -139,6 +139,9 @@ public:
   /// Creates a new distributes communication for that mesh, stores the pointer in _distComs
   void createDistributedCommunication(mesh::PtrMesh mesh);
 
+  /// Returns true, if the arrays of all meshes are sent asynchronously, see DistributedCommunication::isSendAsynchronous().
+  bool isSendAsynchronous() const;
+
   /// Sends an array of double values from all slaves (different for each slave).
   void send(double const *itemsToSend,
             int           size,
@@ -389,6 +389,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
 
     _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}});
   }
+  allocateBuffers();
   e4.stop();
   _isConnected = true;
 }
@@ -519,6 +520,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
 
     _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}});
   }
+  allocateBuffers();
   e4.stop();
   _isConnected = true;
 }
@@ -560,6 +562,7 @@ void PointToPointCommunication::completeSlavesConnection()
   for (auto &i : _connectionDataVector) {
     _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request, {}});
   }
+  allocateBuffers();
 }
 
 void PointToPointCommunication::closeConnection()
@@ -573,6 +576,7 @@ void PointToPointCommunication::closeConnection()
 
   _communication.reset();
   _mappings.clear();
+  _sendBufferPool.clear();
   _isConnected = false;
 }
 
@@ -585,18 +589,20 @@ void PointToPointCommunication::send(double const *itemsToSend,
     return;
   }
 
+  // Return the buffers of completed sends to the pool first
+  checkBufferedRequests(false);
+
   for (auto &mapping : _mappings) {
     // if (utils::MasterSlave::isMaster())
     //   std::cout<< "indices " << mapping.indices << std::endl;
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
+    auto buffer = takeSendBuffer();
+    buffer->resize(mapping.indices.size() * valueDimension);
+    auto packed = buffer->begin();
     for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
-      }
+      packed = std::copy_n(itemsToSend + index * valueDimension, valueDimension, packed);
     }
     auto request = _communication->aSend(*buffer, mapping.remoteRank);
-    bufferedRequests.emplace_back(request, buffer);
+    bufferedRequests.emplace_back(request, std::move(buffer));
   }
   checkBufferedRequests(false);
 }
@@ -681,10 +687,12 @@ void PointToPointCommunication::checkBufferedRequests(bool blocking)
   PRECICE_TRACE(bufferedRequests.size());
   do {
     for (auto it = bufferedRequests.begin(); it != bufferedRequests.end();) {
-      if (it->first->test())
+      if (it->first->test()) {
+        _sendBufferPool.push_back(std::move(it->second));
         it = bufferedRequests.erase(it);
-      else
+      } else {
         ++it;
+      }
     }
     if (bufferedRequests.empty())
       return;
@@ -693,5 +701,29 @@ void PointToPointCommunication::checkBufferedRequests(bool blocking)
   } while (blocking);
 }
 
+void PointToPointCommunication::allocateBuffers()
+{
+  PRECICE_TRACE(_mappings.size());
+  // Sized for vector data, which is the largest data communicated per vertex
+  const int maxValueDimension = _mesh->getDimensions();
+  for (auto &mapping : _mappings) {
+    mapping.recvBuffer.reserve(mapping.indices.size() * maxValueDimension);
+
+    auto buffer = std::make_shared<std::vector<double>>();
+    buffer->reserve(mapping.indices.size() * maxValueDimension);
+    _sendBufferPool.push_back(std::move(buffer));
+  }
+}
+
+std::shared_ptr<std::vector<double>> PointToPointCommunication::takeSendBuffer()
+{
+  if (_sendBufferPool.empty()) {
+    return std::make_shared<std::vector<double>>();
+  }
+  auto buffer = std::move(_sendBufferPool.back());
+  _sendBufferPool.pop_back();
+  return buffer;
+}
+
 } // namespace m2n
 } // namespace precice
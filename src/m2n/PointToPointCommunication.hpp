@@ -89,6 +89,12 @@ public:
    */
   void closeConnection() override;
 
+  /// Returns true, since the values are sent asynchronously from buffers.
+  bool isSendAsynchronous() const override
+  {
+    return true;
+  }
+
   /**
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
@@ -133,6 +139,12 @@ private:
    */
   void checkBufferedRequests(bool blocking);
 
+  /// Reserves the receive buffers and fills the pool of send buffers once the mappings are known
+  void allocateBuffers();
+
+  /// Returns an unused send buffer from the pool or a new one, if all buffers are in use
+  std::shared_ptr<std::vector<double>> takeSendBuffer();
+
   com::PtrCommunicationFactory _communicationFactory;
 
   /// Communication class used for this PointToPointCommunication
@@ -186,6 +198,9 @@ private:
   std::list<std::pair<std::shared_ptr<com::Request>,
                       std::shared_ptr<std::vector<double>>>>
       bufferedRequests;
+
+  /// Send buffers of completed requests, which are reused by subsequent sends
+  std::vector<std::shared_ptr<std::vector<double>>> _sendBufferPool;
 };
 } // namespace m2n
 } // namespace precice
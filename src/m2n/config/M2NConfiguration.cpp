@@ -3,8 +3,10 @@
 #include <ostream>
 #include <stdexcept>
 #include "com/CommunicationFactory.hpp"
+#include "com/DataCompressor.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "logging/LogMacros.hpp"
@@ -51,6 +53,34 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
                                "for the InfiniBand on SuperMUC. ");
     tag.addAttribute(attrNetwork);
 
+    auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
+                                     .setDocumentation(
+                                         "Directory where connection information is exchanged. By default, the "
+                                         "directory of startup is chosen, and both solvers have to be started "
+                                         "in the same directory.");
+    tag.addAttribute(attrExchangeDirectory);
+
+    auto attrCompression = makeXMLAttribute(ATTR_COMPRESSION, "none")
+                               .setOptions({"none", "lossless", "lossy"})
+                               .setDocumentation(
+                                   "Compression of the exchanged coupling data. \"lossless\" shuffles the bytes of the values "
+                                   "and compresses them with zlib. \"lossy\" additionally rounds the values, such that their "
+                                   "relative error is below \"" +
+                                   ATTR_COMPRESSION_TOLERANCE + "\". Both participants have to use the same setting. "
+                                   "Recommended for large interfaces coupled over slow networks.");
+    tag.addAttribute(attrCompression);
+
+    auto attrCompressionTolerance = makeXMLAttribute(ATTR_COMPRESSION_TOLERANCE, 1e-6)
+                                        .setDocumentation(
+                                            "Bound of the relative error of each value, only used by a \"lossy\" compression.");
+    tag.addAttribute(attrCompressionTolerance);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, "shm", occ, TAG);
+    doc = "Communication via POSIX shared memory. Both participants have to run on the same node.";
+    tag.setDocumentation(doc);
+
     auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
                                      .setDocumentation(
                                          "Directory where connection information is exchanged. By default, the "
@@ -148,9 +178,32 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
       PRECICE_CHECK(not utils::isTruncated<unsigned short>(port),
                     "The value given for the \"port\" attribute is not a 16-bit unsigned integer: " << port);
 
+      com::DataCompressor::Mode mode        = com::DataCompressor::Mode::None;
+      const std::string         compression = tag.getStringAttributeValue(ATTR_COMPRESSION);
+      if (compression == "lossless") {
+        mode = com::DataCompressor::Mode::Lossless;
+      } else if (compression == "lossy") {
+        mode = com::DataCompressor::Mode::Lossy;
+      }
+#ifdef PRECICE_NO_ZLIB
+      PRECICE_CHECK(mode == com::DataCompressor::Mode::None,
+                    "The compression \"" << compression << "\" can only be used if preCICE was compiled with zlib support enabled. "
+                                          << "Either set compression=\"none\" or recompile preCICE with \"PRECICE_ZlibCompression=ON\".");
+#endif
+      com::DataCompressor compressor(mode, tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE));
+
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
-      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
+      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir, compressor);
       com             = comFactory->newCommunication();
+    } else if (tag.getName() == "shm") {
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+#ifdef PRECICE_NO_SHM
+      PRECICE_ERROR("Communication type \"shm\" can only be used on platforms supporting POSIX shared memory. "
+                    "Please switch to a \"sockets\" communication.");
+#else
+      comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(dir);
+      com        = comFactory->newCommunication();
+#endif
     } else if (tag.getName() == "mpi") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #ifdef PRECICE_NO_MPI
@@ -119,6 +119,69 @@ void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
   }
 }
 
+/// Sends scalar and vector data several times in a row, which reuses the send and receive buffers
+void runP2PComRepeatedTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true, testing::nextMeshID()));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  vector<double> data;
+  vector<double> expectedData;
+
+  if (context.isNamed("A")) {
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(10);
+      mesh->getVertexDistribution()[0] = {0, 1, 3, 5, 7};
+      mesh->getVertexDistribution()[1] = {1, 2, 4, 5, 6};
+      data                             = {10, 20, 40, 60, 80};
+    } else {
+      data = {20, 30, 50, 60, 70};
+    }
+  } else {
+    BOOST_TEST(context.isNamed("B"));
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(10);
+      mesh->getVertexDistribution()[0] = {1, 2, 5, 6};
+      mesh->getVertexDistribution()[1] = {0, 1, 3, 4, 5, 7};
+      data.assign(4, -1);
+      expectedData = {2 * 20, 30, 2 * 60, 70};
+    } else {
+      data.assign(6, -1);
+      expectedData = {10, 2 * 20, 40, 50, 2 * 60, 80};
+    }
+  }
+
+  if (context.isNamed("A")) {
+    c.requestConnection("B", "A");
+    vector<double> vectorData;
+    for (double value : data) {
+      vectorData.push_back(value);
+      vectorData.push_back(-value);
+    }
+    for (int round = 0; round < 3; ++round) {
+      c.send(data.data(), data.size());
+      c.send(vectorData.data(), vectorData.size(), 2);
+    }
+  } else {
+    c.acceptConnection("B", "A");
+    vector<double> expectedVectorData;
+    for (double value : expectedData) {
+      expectedVectorData.push_back(value);
+      expectedVectorData.push_back(-value);
+    }
+    vector<double> vectorData(2 * data.size(), -1);
+    for (int round = 0; round < 3; ++round) {
+      c.receive(data.data(), data.size());
+      BOOST_TEST(data == expectedData);
+      c.receive(vectorData.data(), vectorData.size(), 2);
+      BOOST_TEST(vectorData == expectedVectorData);
+    }
+  }
+}
+
 /// a very similar test, but with a vertex that has been completely filtered out
 void runP2PComTest2(const TestContext &context, com::PtrCommunicationFactory cf)
 {
@@ -520,6 +583,13 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComRepeatedTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComRepeatedTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
@@ -573,6 +643,13 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComRepeatedTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  runP2PComRepeatedTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
@@ -0,0 +1,485 @@
+#pragma once
+
+#include "Mapping.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/version.hpp>
+#if BOOST_VERSION < 106600
+#include <boost/function_output_iterator.hpp>
+#else
+#include <boost/iterator/function_output_iterator.hpp>
+#endif
+#include <boost/geometry/index/rtree.hpp>
+
+#include "config/MappingConfiguration.hpp"
+#include "impl/BasisFunctions.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/RTree.hpp"
+#include "utils/Event.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions on localized clusters.
+ *
+ * In contrast to RadialBasisFctMapping, no global interpolation system is built.
+ * Every output vertex is interpolated from a cluster formed by its k nearest input
+ * vertices, for which a small RBF system is solved. This is not a partition-of-unity
+ * method: the clusters overlap, one cluster is built per output vertex and no blending
+ * of cluster interpolants takes place. The nearest vertices are searched in the
+ * coordinates without the dead axes.
+ *
+ * The polynomial of every cluster is linear. It is either part of the cluster system (ON),
+ * left out (OFF), or fitted to the cluster values in a least-squares sense before the RBF
+ * interpolates the residual (SEPARATE). Except for OFF, the weights of each cluster sum to one.
+ *
+ * The interpolation weights are stored as sparse rows, one per vertex of the output mesh,
+ * which map() applies in parallel using the ThreadPool.
+ * The conservative variant stores the transpose of the consistent operator
+ * from the output to the input mesh.
+ *
+ * The clusters are built from the local mesh partition only. Hence, the meshes
+ * are never gathered on the master rank and no communication between ranks is
+ * required, neither in computeMapping() nor in map().
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class LocalRadialBasisFctMapping : public Mapping {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for mapping.
+   * @param[in] verticesPerCluster Amount of input vertices per cluster
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] polynomial Treatment of the linear polynomial of the clusters
+   */
+  LocalRadialBasisFctMapping(
+      Constraint              constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      int                     verticesPerCluster,
+      bool                    xDead,
+      bool                    yDead,
+      bool                    zDead,
+      Polynomial              polynomial = Polynomial::ON);
+
+  /// Computes the interpolation weights of all clusters.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID) override;
+
+  /// Tags all vertices of the remote mesh, which are part of a cluster.
+  virtual void tagMeshFirstRound() override;
+
+  virtual void tagMeshSecondRound() override;
+
+private:
+  precice::logging::Logger _log{"mapping::LocalRadialBasisFctMapping"};
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// Maximal amount of vertices used in the interpolation of one vertex
+  int _verticesPerCluster;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  Polynomial _polynomial;
+
+  /// Offsets of the rows in _rowIndices and _rowWeights, one per vertex of the output mesh plus one.
+  std::vector<size_t> _rowOffsets;
+
+  /// Input vertex indices of all rows, stored consecutively
+  std::vector<size_t> _rowIndices;
+
+  /// Weights of all rows, stored consecutively
+  std::vector<double> _rowWeights;
+
+  /// Returns the coordinates of the vertex with the dead axes removed
+  Eigen::VectorXd reduced(const mesh::Vertex::RawCoords &coords) const;
+
+  /// Returns the coordinates of the vertex with the dead axes set to zero, which is used to search clusters
+  Eigen::VectorXd projected(const mesh::Vertex::RawCoords &coords) const;
+
+  /**
+   * @brief Computes the weights of the cluster values interpolating at outCoords.
+   *
+   * @return false, if the system of the cluster is singular
+   */
+  bool computeWeights(const std::vector<Eigen::VectorXd> &clusterCoords, const Eigen::VectorXd &outCoords, Eigen::Ref<Eigen::VectorXd> weights) const;
+
+  void setDeadAxis(bool xDead, bool yDead, bool zDead)
+  {
+    _deadAxis.resize(getDimensions());
+    if (getDimensions() == 2) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      PRECICE_CHECK(not(xDead && yDead), "You cannot choose all axes to be dead for a RBF mapping");
+      if (zDead)
+        PRECICE_WARN("Setting the z-axis to dead on a 2-dimensional problem has no effect.");
+    } else if (getDimensions() == 3) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      _deadAxis[2] = zDead;
+      PRECICE_CHECK(not(xDead && yDead && zDead), "You cannot choose all axes to be dead for a RBF mapping");
+    } else {
+      PRECICE_ASSERT(false);
+    }
+  }
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::LocalRadialBasisFctMapping(
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    int                     verticesPerCluster,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead,
+    Polynomial              polynomial)
+    : Mapping(constraint, dimensions),
+      _basisFunction(function),
+      _verticesPerCluster(verticesPerCluster),
+      _polynomial(polynomial)
+{
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  setDeadAxis(xDead, yDead, zDead);
+  PRECICE_CHECK(_verticesPerCluster > 0, "The amount of vertices per cluster of a localized RBF mapping has to be positive.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+
+  precice::utils::Event e("map.lrbf.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
+                 input()->getDimensions(), output()->getDimensions());
+  PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
+                 getDimensions(), output()->getDimensions());
+
+  // The clusters are taken from inMesh and interpolate to the vertices of outMesh
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (getConstraint() == CONSERVATIVE) {
+    inMesh  = output();
+    outMesh = input();
+  } else { // Consistent
+    inMesh  = input();
+    outMesh = output();
+  }
+
+  const auto &inVertices  = inMesh->vertices();
+  const auto &outVertices = outMesh->vertices();
+
+  _rowOffsets.assign(output()->vertices().size() + 1, 0);
+  _rowIndices.clear();
+  _rowWeights.clear();
+
+  if (outVertices.empty()) {
+    _hasComputedMapping = true;
+    return;
+  }
+
+  const int polyparams  = 1 + std::count(_deadAxis.begin(), _deadAxis.end(), false);
+  const int minimalSize = (_polynomial == Polynomial::OFF) ? 1 : 1 + polyparams;
+  const int clusterSize = std::min<int>(_verticesPerCluster, inVertices.size());
+  PRECICE_CHECK(clusterSize >= minimalSize,
+                "The localized RBF mapping from mesh " << input()->getName() << " to mesh " << output()->getName()
+                                                       << " requires clusters of at least " << minimalSize << " vertices, but only "
+                                                       << clusterSize << " are available. Please increase vertices-per-cluster or "
+                                                       << "check if the meshes are correct.");
+
+  // Every cluster has exactly clusterSize vertices, hence cluster i is stored at i * clusterSize
+  std::vector<size_t> clusterIndices(outVertices.size() * clusterSize);
+  Eigen::MatrixXd     clusterWeights(clusterSize, outVertices.size());
+  std::vector<char>   singular(outVertices.size(), false);
+
+  // The cached tree of the mesh is only usable, if all axes take part in the distances
+  using ProjectedValue = std::pair<Eigen::VectorXd, size_t>;
+  using ProjectedTree  = boost::geometry::index::rtree<ProjectedValue, query::impl::RTreeParameters>;
+  const bool                       anyDead = std::find(_deadAxis.begin(), _deadAxis.end(), true) != _deadAxis.end();
+  query::rtree::vertex_traits::Ptr rtree;
+  ProjectedTree                    projectedTree;
+  if (anyDead) {
+    std::vector<ProjectedValue> values;
+    values.reserve(inVertices.size());
+    for (size_t i = 0; i < inVertices.size(); ++i) {
+      values.emplace_back(projected(inVertices[i].getCoords()), i);
+    }
+    projectedTree = ProjectedTree(values);
+  } else {
+    rtree = query::rtree::getVertexRTree(inMesh);
+  }
+
+  utils::ThreadPool::instance().parallelFor(0, outVertices.size(), [&](size_t i) {
+    size_t *cluster = &clusterIndices[i * clusterSize];
+    int     found   = 0;
+    if (anyDead) {
+      projectedTree.query(boost::geometry::index::nearest(projected(outVertices[i].getCoords()), clusterSize),
+                          boost::make_function_output_iterator([&](const ProjectedValue &value) {
+                            cluster[found++] = value.second;
+                          }));
+    } else {
+      rtree->query(boost::geometry::index::nearest(outVertices[i].getCoords(), clusterSize),
+                   boost::make_function_output_iterator([&](size_t index) {
+                     cluster[found++] = index;
+                   }));
+    }
+    PRECICE_ASSERT(found == clusterSize, found, clusterSize);
+    // Make the result independent of the order returned by the tree
+    std::sort(cluster, cluster + clusterSize);
+
+    std::vector<Eigen::VectorXd> clusterCoords;
+    clusterCoords.reserve(clusterSize);
+    for (int k = 0; k < clusterSize; ++k) {
+      clusterCoords.push_back(reduced(inVertices[cluster[k]].getCoords()));
+    }
+    singular[i] = not computeWeights(clusterCoords, reduced(outVertices[i].getCoords()), clusterWeights.col(i));
+  });
+
+  PRECICE_CHECK(std::find(singular.begin(), singular.end(), true) == singular.end(),
+                "The interpolation matrix of a cluster of the localized RBF mapping from mesh " << input()->getName() << " to mesh "
+                                                                                                << output()->getName() << " is not invertable. This means that the mapping problem is not well-posed. "
+                                                                                                << "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
+                                                                                                << "by marking perpendicular axes as dead?");
+
+  if (getConstraint() == CONSISTENT) {
+    // One cluster per output vertex, the clusters are the rows
+    for (size_t i = 0; i < outVertices.size(); ++i) {
+      _rowOffsets[i + 1] = (i + 1) * clusterSize;
+    }
+    _rowIndices = std::move(clusterIndices);
+    _rowWeights.assign(clusterWeights.data(), clusterWeights.data() + clusterWeights.size());
+  } else {
+    // Transpose the clusters, such that every row gathers the values of the input vertices using it
+    for (size_t index : clusterIndices) {
+      ++_rowOffsets[index + 1];
+    }
+    for (size_t row = 0; row + 1 < _rowOffsets.size(); ++row) {
+      _rowOffsets[row + 1] += _rowOffsets[row];
+    }
+    _rowIndices.resize(clusterIndices.size());
+    _rowWeights.resize(clusterIndices.size());
+    std::vector<size_t> position(_rowOffsets.begin(), _rowOffsets.end() - 1);
+    for (size_t i = 0; i < outVertices.size(); ++i) {
+      for (int k = 0; k < clusterSize; ++k) {
+        const size_t row           = clusterIndices[i * clusterSize + k];
+        _rowIndices[position[row]] = i;
+        _rowWeights[position[row]] = clusterWeights(k, i);
+        ++position[row];
+      }
+    }
+  }
+
+  _hasComputedMapping = true;
+  PRECICE_DEBUG("Compute Mapping is Completed.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeWeights(
+    const std::vector<Eigen::VectorXd> &clusterCoords,
+    const Eigen::VectorXd &             outCoords,
+    Eigen::Ref<Eigen::VectorXd>         weights) const
+{
+  const int n          = clusterCoords.size();
+  const int polyparams = 1 + outCoords.size();
+  const int systemSize = (_polynomial == Polynomial::ON) ? n + polyparams : n;
+
+  // Interpolation system of the cluster, including the linear polynomial if it is integrated
+  Eigen::MatrixXd matrixC = Eigen::MatrixXd::Zero(systemSize, systemSize);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) {
+      matrixC(i, j) = _basisFunction.evaluate((clusterCoords[i] - clusterCoords[j]).norm());
+    }
+    if (_polynomial == Polynomial::ON) {
+      matrixC(i, n)                                = 1.0;
+      matrixC.row(i).segment(n + 1, polyparams - 1) = clusterCoords[i].transpose();
+    }
+  }
+  matrixC.template triangularView<Eigen::Lower>() = matrixC.transpose();
+
+  // Evaluation of the basis functions and the integrated polynomial at the output vertex
+  Eigen::VectorXd evaluation(systemSize);
+  for (int i = 0; i < n; ++i) {
+    evaluation(i) = _basisFunction.evaluate((clusterCoords[i] - outCoords).norm());
+  }
+  if (_polynomial == Polynomial::ON) {
+    evaluation(n)                   = 1.0;
+    evaluation.tail(polyparams - 1) = outCoords;
+  }
+
+  // The system is symmetric, hence the weights are given by C^-1 * evaluation
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr = matrixC.colPivHouseholderQr();
+  if (not qr.isInvertible()) {
+    return false;
+  }
+  const Eigen::VectorXd solution = qr.solve(evaluation);
+  weights                         = solution.head(n);
+
+  if (_polynomial == Polynomial::SEPARATE) {
+    // The polynomial is fitted to the values by least squares, the RBF interpolates the residual.
+    // With the basis Q of the polynomial and its evaluation q at the output vertex, this adds Q (Q^T Q)^-1 (q - Q^T w).
+    Eigen::MatrixXd matrixQ(n, polyparams);
+    for (int i = 0; i < n; ++i) {
+      matrixQ(i, 0)                       = 1.0;
+      matrixQ.row(i).tail(polyparams - 1) = clusterCoords[i].transpose();
+    }
+    Eigen::VectorXd q(polyparams);
+    q(0)                   = 1.0;
+    q.tail(polyparams - 1) = outCoords;
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qrQ = (matrixQ.transpose() * matrixQ).colPivHouseholderQr();
+    if (not qrQ.isInvertible()) {
+      return false;
+    }
+    weights += matrixQ * qrQ.solve(q - matrixQ.transpose() * weights);
+  }
+  return true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  _rowOffsets.clear();
+  _rowIndices.clear();
+  _rowWeights.clear();
+  _hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
+    int inputDataID,
+    int outputDataID)
+{
+  PRECICE_TRACE(inputDataID, outputDataID);
+
+  precice::utils::Event e("map.lrbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(_hasComputedMapping);
+  const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
+  Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
+
+  const int valueDim = input()->data(inputDataID)->getDimensions();
+  PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
+                 valueDim, output()->data(outputDataID)->getDimensions());
+  const size_t rows = _rowOffsets.size() - 1;
+  PRECICE_ASSERT(rows == output()->vertices().size(), rows, output()->vertices().size());
+  outputValues.setZero();
+
+  // Every row only writes the values of its own output vertex
+  utils::ThreadPool::instance().parallelFor(0, rows, [&](size_t row) {
+    for (size_t k = _rowOffsets[row]; k < _rowOffsets[row + 1]; ++k) {
+      const size_t inOffset = _rowIndices[k] * valueDim;
+      for (int dim = 0; dim < valueDim; ++dim) {
+        outputValues[row * valueDim + dim] += _rowWeights[k] * inputValues[inOffset + dim];
+      }
+    }
+  });
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.lrbf.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  mesh::PtrMesh otherMesh; // local
+  if (getConstraint() == CONSISTENT) {
+    otherMesh = output();
+  } else {
+    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
+    otherMesh = input();
+  }
+
+  if (otherMesh->vertices().empty())
+    return; // Ranks not at the interface should never hold interface vertices
+
+  computeMapping();
+
+  if (getConstraint() == CONSISTENT) {
+    // Tag the input vertices used by any row
+    for (size_t index : _rowIndices) {
+      input()->vertices()[index].tag();
+    }
+  } else {
+    // Tag the output vertices with a non-empty row
+    for (size_t row = 0; row + 1 < _rowOffsets.size(); ++row) {
+      if (_rowOffsets[row + 1] > _rowOffsets[row]) {
+        output()->vertices()[row].tag();
+      }
+    }
+  }
+
+  clear();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  PRECICE_TRACE();
+  // All required vertices are tagged in the first round
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduced(const mesh::Vertex::RawCoords &coords) const
+{
+  Eigen::VectorXd result(std::count(_deadAxis.begin(), _deadAxis.end(), false));
+  int             k = 0;
+  for (int d = 0; d < getDimensions(); ++d) {
+    if (not _deadAxis[d]) {
+      result[k++] = coords[d];
+    }
+  }
+  return result;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::projected(const mesh::Vertex::RawCoords &coords) const
+{
+  Eigen::VectorXd result = coords;
+  for (int d = 0; d < getDimensions(); ++d) {
+    if (_deadAxis[d]) {
+      result[d] = 0.0;
+    }
+  }
+  return result;
+}
+
+} // namespace mapping
+} // namespace precice
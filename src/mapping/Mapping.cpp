@@ -51,6 +51,16 @@ Mapping::MeshRequirement Mapping::getOutputRequirement() const
   return _outputRequirement;
 }
 
+void Mapping::mapBatch(
+    const std::vector<int> &inputDataIDs,
+    const std::vector<int> &outputDataIDs)
+{
+  PRECICE_ASSERT(inputDataIDs.size() == outputDataIDs.size(), inputDataIDs.size(), outputDataIDs.size());
+  for (size_t i = 0; i < inputDataIDs.size(); ++i) {
+    map(inputDataIDs[i], outputDataIDs[i]);
+  }
+}
+
 mesh::PtrMesh Mapping::input() const
 {
   return _input;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iosfwd>
+#include <vector>
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 
@@ -100,6 +101,20 @@ public:
       int inputDataID,
       int outputDataID) = 0;
 
+  /**
+   * @brief Maps several data fields at once from input mesh to output mesh.
+   *
+   * The data fields are given pairwise, i.e., inputDataIDs[i] is mapped to outputDataIDs[i].
+   * The default implementation maps each pair separately. Mappings which solve a system
+   * can override this to solve for all data fields with one multi right-hand side solve.
+   *
+   * Pre-conditions:
+   * - hasComputedMapping() returns true
+   */
+  virtual void mapBatch(
+      const std::vector<int> &inputDataIDs,
+      const std::vector<int> &outputDataIDs);
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -1,6 +1,7 @@
 #include "NearestNeighborMapping.hpp"
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <functional>
 #include <memory>
@@ -20,6 +21,7 @@
 #include "query/RTree.hpp"
 #include "utils/Event.hpp"
 #include "utils/Statistics.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -27,6 +29,57 @@ extern bool syncMode;
 
 namespace mapping {
 
+namespace {
+/**
+ * @brief Sets output vertex i to the value of input vertex indices[i] for all i in [begin, end).
+ *
+ * DIM is the dimension of the values if known at compile time, which allows the compiler to unroll
+ * the inner loop, otherwise Eigen::Dynamic.
+ */
+template <int DIM>
+void gather(const int *indices, const double *input, double *output, int dimensions, std::size_t begin, std::size_t end)
+{
+  const int dim = (DIM == Eigen::Dynamic) ? dimensions : DIM;
+  for (std::size_t i = begin; i < end; ++i) {
+    const double *in  = input + static_cast<std::size_t>(indices[i]) * dim;
+    double *      out = output + i * dim;
+    for (int d = 0; d < dim; ++d) {
+      out[d] = in[d];
+    }
+  }
+}
+
+/// Adds the value of input vertex i to output vertex indices[i] for all i in [begin, end).
+template <int DIM>
+void scatterSum(const int *indices, const double *input, double *output, int dimensions, std::size_t begin, std::size_t end)
+{
+  const int dim = (DIM == Eigen::Dynamic) ? dimensions : DIM;
+  for (std::size_t i = begin; i < end; ++i) {
+    const double *in  = input + i * dim;
+    double *      out = output + static_cast<std::size_t>(indices[i]) * dim;
+    for (int d = 0; d < dim; ++d) {
+      out[d] += in[d];
+    }
+  }
+}
+
+/// Adds the values of all input vertices mapped to output vertex i to output vertex i for all i in [begin, end).
+template <int DIM>
+void gatherSum(const int *offsets, const int *indices, const double *input, double *output, int dimensions, std::size_t begin, std::size_t end)
+{
+  const int dim = (DIM == Eigen::Dynamic) ? dimensions : DIM;
+  for (std::size_t i = begin; i < end; ++i) {
+    double *out = output + i * dim;
+    for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+      const double *in = input + static_cast<std::size_t>(indices[j]) * dim;
+      for (int d = 0; d < dim; ++d) {
+        out[d] += in[d];
+      }
+    }
+  }
+}
+} // namespace
+
 NearestNeighborMapping::NearestNeighborMapping(
     Constraint constraint,
     int        dimensions)
@@ -53,17 +106,24 @@ void NearestNeighborMapping::computeMapping()
     e2.stop();
     size_t verticesSize = output()->vertices().size();
     _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    outputVertices = output()->vertices();
-    for (size_t i = 0; i < verticesSize; i++) {
-      const Eigen::VectorXd &coords = outputVertices[i].getCoords();
+    std::vector<double>                distances(verticesSize, -1.0);
+    const mesh::Mesh::VertexContainer &outputVertices = output()->vertices();
+    const mesh::Mesh::VertexContainer &inputVertices  = input()->vertices();
+    utils::ThreadPool::instance().parallelFor(0, verticesSize, [&](size_t i) {
+      const auto &coords = outputVertices[i].getCoords();
       // Search for the output vertex inside the input mesh and add index to _vertexIndices
       rtree->query(boost::geometry::index::nearest(coords, 1),
                    boost::make_function_output_iterator([&](size_t const &val) {
-                     const auto &match = input()->vertices()[val];
+                     const auto &match = inputVertices[val];
                      _vertexIndices[i] = match.getID();
-                     distanceStatistics(bg::distance(match, coords));
+                     distances[i]      = bg::distance(match, coords);
                    }));
+    });
+    utils::statistics::DistanceAccumulator distanceStatistics;
+    for (double distance : distances) {
+      if (distance >= 0.0) { // no match is found in empty meshes
+        distanceStatistics(distance);
+      }
     }
     if (distanceStatistics.empty()) {
       PRECICE_INFO("Mapping distance not available due to empty partition.");
@@ -78,27 +138,67 @@ void NearestNeighborMapping::computeMapping()
     e2.stop();
     size_t verticesSize = input()->vertices().size();
     _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    inputVertices = input()->vertices();
-    for (size_t i = 0; i < verticesSize; i++) {
-      const Eigen::VectorXd &coords = inputVertices[i].getCoords();
+    std::vector<double>                distances(verticesSize, -1.0);
+    const mesh::Mesh::VertexContainer &inputVertices  = input()->vertices();
+    const mesh::Mesh::VertexContainer &outputVertices = output()->vertices();
+    utils::ThreadPool::instance().parallelFor(0, verticesSize, [&](size_t i) {
+      const auto &coords = inputVertices[i].getCoords();
       // Search for the input vertex inside the output mesh and add index to _vertexIndices
       rtree->query(boost::geometry::index::nearest(coords, 1),
                    boost::make_function_output_iterator([&](size_t const &val) {
-                     const auto &match = output()->vertices()[val];
+                     const auto &match = outputVertices[val];
                      _vertexIndices[i] = match.getID();
-                     distanceStatistics(bg::distance(match, coords));
+                     distances[i]      = bg::distance(match, coords);
                    }));
+    });
+    utils::statistics::DistanceAccumulator distanceStatistics;
+    for (double distance : distances) {
+      if (distance >= 0.0) { // no match is found in empty meshes
+        distanceStatistics(distance);
+      }
     }
     if (distanceStatistics.empty()) {
       PRECICE_INFO("Mapping distance not available due to empty partition.");
     } else {
       PRECICE_INFO("Mapping distance " << distanceStatistics);
     }
+
+    if (utils::ThreadPool::instance().getThreads() > 1) {
+      invertIndices(distances);
+    } else {
+      _conservativeOffsets.clear();
+      _conservativeIndices.clear();
+    }
   }
   _hasComputedMapping = true;
 }
 
+void NearestNeighborMapping::invertIndices(const std::vector<double> &distances)
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.nn.invertIndices.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  // Sort the input vertices by the output vertex they are mapped to, skipping vertices without match
+  const size_t verticesSize = _vertexIndices.size();
+  const size_t outSize      = output()->vertices().size();
+  _conservativeOffsets.assign(outSize + 1, 0);
+  for (size_t i = 0; i < verticesSize; ++i) {
+    if (distances[i] >= 0.0) {
+      ++_conservativeOffsets[_vertexIndices[i] + 1];
+    }
+  }
+  for (size_t i = 0; i < outSize; ++i) {
+    _conservativeOffsets[i + 1] += _conservativeOffsets[i];
+  }
+  _conservativeIndices.resize(_conservativeOffsets.back());
+  std::vector<int> positions(_conservativeOffsets.begin(), _conservativeOffsets.end() - 1);
+  for (size_t i = 0; i < verticesSize; ++i) {
+    if (distances[i] >= 0.0) {
+      _conservativeIndices[positions[_vertexIndices[i]]++] = i;
+    }
+  }
+}
+
 bool NearestNeighborMapping::hasComputedMapping() const
 {
   PRECICE_TRACE(_hasComputedMapping);
@@ -109,12 +209,9 @@ void NearestNeighborMapping::clear()
 {
   PRECICE_TRACE();
   _vertexIndices.clear();
+  _conservativeOffsets.clear();
+  _conservativeIndices.clear();
   _hasComputedMapping = false;
-  if (getConstraint() == CONSISTENT) {
-    query::rtree::clear(*input());
-  } else {
-    query::rtree::clear(*output());
-  }
 }
 
 void NearestNeighborMapping::map(
@@ -125,35 +222,121 @@ void NearestNeighborMapping::map(
 
   precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
-  const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
-  Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
-  //assign(outputValues) = 0.0;
-  int valueDimensions = input()->data(inputDataID)->getDimensions();
+  PRECICE_DEBUG((getConstraint() == CONSISTENT ? "Map consistent" : "Map conservative"));
+  mapFields({getField(inputDataID, outputDataID)});
+}
+
+void NearestNeighborMapping::mapBatch(
+    const std::vector<int> &inputDataIDs,
+    const std::vector<int> &outputDataIDs)
+{
+  PRECICE_TRACE(inputDataIDs.size());
+  PRECICE_ASSERT(inputDataIDs.size() == outputDataIDs.size(), inputDataIDs.size(), outputDataIDs.size());
+
+  precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  std::vector<Field> fields;
+  for (size_t k = 0; k < inputDataIDs.size(); ++k) {
+    fields.push_back(getField(inputDataIDs[k], outputDataIDs[k]));
+  }
+  PRECICE_DEBUG((getConstraint() == CONSISTENT ? "Map consistent" : "Map conservative") << " batch of " << fields.size() << " data fields");
+  mapFields(fields);
+}
+
+NearestNeighborMapping::Field NearestNeighborMapping::getField(
+    int inputDataID,
+    int outputDataID) const
+{
+  const Eigen::VectorXd &inputValues     = input()->data(inputDataID)->values();
+  Eigen::VectorXd &      outputValues    = output()->data(outputDataID)->values();
+  int                    valueDimensions = input()->data(inputDataID)->getDimensions();
   PRECICE_ASSERT(valueDimensions == output()->data(outputDataID)->getDimensions(),
                  valueDimensions, output()->data(outputDataID)->getDimensions());
   PRECICE_ASSERT(inputValues.size() / valueDimensions == (int) input()->vertices().size(),
                  inputValues.size(), valueDimensions, input()->vertices().size());
   PRECICE_ASSERT(outputValues.size() / valueDimensions == (int) output()->vertices().size(),
                  outputValues.size(), valueDimensions, output()->vertices().size());
+  return {inputValues.data(), outputValues.data(), valueDimensions};
+}
+
+void NearestNeighborMapping::mapFields(const std::vector<Field> &fields) const
+{
+  // All fields are mapped block by block, such that the indices of a block stay in cache
+  constexpr size_t blockSize = 4096;
+  const size_t     outSize   = output()->vertices().size();
+  const size_t     blocks    = (outSize + blockSize - 1) / blockSize;
+
   if (getConstraint() == CONSISTENT) {
-    PRECICE_DEBUG("Map consistent");
-    size_t const outSize = output()->vertices().size();
-    for (size_t i = 0; i < outSize; i++) {
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues((i * valueDimensions) + dim) = inputValues(inputIndex + dim);
+    PRECICE_ASSERT(_vertexIndices.size() == outSize, _vertexIndices.size(), outSize);
+    const int *indices = _vertexIndices.data();
+    utils::ThreadPool::instance().parallelFor(0, blocks, [&](size_t block) {
+      const size_t begin = block * blockSize;
+      const size_t end   = std::min(begin + blockSize, outSize);
+      for (const Field &field : fields) {
+        switch (field.dimensions) {
+        case 1:
+          gather<1>(indices, field.input, field.output, 1, begin, end);
+          break;
+        case 2:
+          gather<2>(indices, field.input, field.output, 2, begin, end);
+          break;
+        case 3:
+          gather<3>(indices, field.input, field.output, 3, begin, end);
+          break;
+        default:
+          gather<Eigen::Dynamic>(indices, field.input, field.output, field.dimensions, begin, end);
+        }
+      }
+    });
+  } else if (_conservativeOffsets.empty()) {
+    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
+    // Several input vertices can be mapped to the same output vertex, hence this loop remains serial
+    const int *  indices = _vertexIndices.data();
+    const size_t inSize  = input()->vertices().size();
+    PRECICE_ASSERT(_vertexIndices.size() == inSize, _vertexIndices.size(), inSize);
+    for (size_t begin = 0; begin < inSize; begin += blockSize) {
+      const size_t end = std::min(begin + blockSize, inSize);
+      for (const Field &field : fields) {
+        switch (field.dimensions) {
+        case 1:
+          scatterSum<1>(indices, field.input, field.output, 1, begin, end);
+          break;
+        case 2:
+          scatterSum<2>(indices, field.input, field.output, 2, begin, end);
+          break;
+        case 3:
+          scatterSum<3>(indices, field.input, field.output, 3, begin, end);
+          break;
+        default:
+          scatterSum<Eigen::Dynamic>(indices, field.input, field.output, field.dimensions, begin, end);
+        }
       }
     }
   } else {
     PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
-    PRECICE_DEBUG("Map conservative");
-    size_t const inSize = input()->vertices().size();
-    for (size_t i = 0; i < inSize; i++) {
-      int const outputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues(outputIndex + dim) += inputValues((i * valueDimensions) + dim);
+    PRECICE_ASSERT(_conservativeOffsets.size() == outSize + 1, _conservativeOffsets.size(), outSize);
+    // Every output vertex sums up its own input vertices, hence blocks of output vertices are independent
+    const int *offsets = _conservativeOffsets.data();
+    const int *indices = _conservativeIndices.data();
+    utils::ThreadPool::instance().parallelFor(0, blocks, [&](size_t block) {
+      const size_t begin = block * blockSize;
+      const size_t end   = std::min(begin + blockSize, outSize);
+      for (const Field &field : fields) {
+        switch (field.dimensions) {
+        case 1:
+          gatherSum<1>(offsets, indices, field.input, field.output, 1, begin, end);
+          break;
+        case 2:
+          gatherSum<2>(offsets, indices, field.input, field.output, 2, begin, end);
+          break;
+        case 3:
+          gatherSum<3>(offsets, indices, field.input, field.output, 3, begin, end);
+          break;
+        default:
+          gatherSum<Eigen::Dynamic>(offsets, indices, field.input, field.output, field.dimensions, begin, end);
+        }
       }
-    }
+    });
   }
 }
 
@@ -36,6 +36,11 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Maps several data fields at once, traversing the vertex indices only once.
+  virtual void mapBatch(
+      const std::vector<int> &inputDataIDs,
+      const std::vector<int> &outputDataIDs) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -47,6 +52,34 @@ private:
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+  /**
+   * @brief Input vertices mapped to each output vertex of a conservative mapping in CSR format.
+   *
+   * The input vertices of output vertex i are _conservativeIndices[_conservativeOffsets[i]] to
+   * _conservativeIndices[_conservativeOffsets[i+1] - 1] in ascending order. This turns the
+   * scatter-add of the conservative mapping into a gather, which can run in parallel.
+   * Only computed if the thread pool has more than one thread, since the serial scatter-add is faster.
+   */
+  std::vector<int> _conservativeOffsets;
+
+  std::vector<int> _conservativeIndices;
+
+  /// Values of one data field to be mapped
+  struct Field {
+    const double *input;
+    double *      output;
+    int           dimensions;
+  };
+
+  /// Computes _conservativeOffsets and _conservativeIndices from _vertexIndices, skipping input vertices without match.
+  void invertIndices(const std::vector<double> &distances);
+
+  /// Returns the values of the given pair of data fields.
+  Field getField(int inputDataID, int outputDataID) const;
+
+  /// Maps all fields in one pass over the output vertices.
+  void mapFields(const std::vector<Field> &fields) const;
 };
 
 } // namespace mapping
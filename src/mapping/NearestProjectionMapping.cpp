@@ -5,7 +5,6 @@
 #include <deque>
 #include <memory>
 #include <ostream>
-#include <unordered_set>
 #include <utility>
 
 #include <boost/version.hpp>
@@ -26,6 +25,7 @@
 #include "query/RTree.hpp"
 #include "utils/Event.hpp"
 #include "utils/Statistics.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/assertion.hpp"
 
 namespace bg  = boost::geometry;
@@ -88,7 +88,7 @@ void NearestProjectionMapping::computeMapping()
   const auto &tVertices = search_space->vertices();
   const auto &tEdges    = search_space->edges();
 
-  _weights.resize(fVertices.size());
+  std::vector<InterpolationElements> weights(fVertices.size());
 
   // Amount of nearest elements to fetch for detailed comparison.
   // This safety margin results in a candidate set which forms the base for the
@@ -96,6 +96,55 @@ void NearestProjectionMapping::computeMapping()
   // @TODO Add a configuration option for this factor
   constexpr int nnearest = 4;
 
+  // Distance to the match of every origin, the searches for the origins run in parallel
+  std::vector<double> distances(fVertices.size(), -1.0);
+  auto &              pool = utils::ThreadPool::instance();
+
+  // Searches the nearest elements for the projection of the given origin, returns true if a valid projection was found
+  auto projectOnto = [&](size_t i, const auto &index, const auto &candidates, auto toElementIndex) {
+    const auto &           coords = fVertices[i].getCoords();
+    std::vector<MatchType> matches;
+    matches.reserve(nnearest);
+    index->query(bg::index::nearest(coords, nnearest),
+                 boost::make_function_output_iterator([&](const auto &match) {
+                   const int elementIndex = toElementIndex(match);
+                   matches.emplace_back(bg::distance(coords, candidates[elementIndex]), elementIndex);
+                 }));
+    std::sort(matches.begin(), matches.end());
+    for (const auto &match : matches) {
+      auto elements = query::generateInterpolationElements(fVertices[i], candidates[match.index]);
+      if (std::all_of(elements.begin(), elements.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
+        weights[i]   = std::move(elements);
+        distances[i] = match.distance;
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Falls back to the nearest vertex for the given origin
+  auto projectOntoVertex = [&](size_t i, const query::rtree::vertex_traits::Ptr &index) {
+    index->query(bg::index::nearest(fVertices[i].getCoords(), 1),
+                 boost::make_function_output_iterator([&](int match) {
+                   weights[i]   = query::generateInterpolationElements(fVertices[i], tVertices[match]);
+                   distances[i] = bg::distance(fVertices[i], tVertices[match]);
+                 }));
+  };
+
+  auto identity = [](int match) { return match; };
+
+  // Origins which are not matched by a projection, yet
+  std::vector<size_t> unmatched;
+  std::vector<char>   matched(fVertices.size(), false);
+  auto                collectUnmatched = [&] {
+    unmatched.clear();
+    for (size_t i = 0; i < fVertices.size(); ++i) {
+      if (not matched[i]) {
+        unmatched.push_back(i);
+      }
+    }
+  };
+
   if (getDimensions() == 2) {
     if (!fVertices.empty() && tEdges.empty()) {
       PRECICE_WARN("2D Mesh \"" << search_space->getName() << "\" does not contain edges. Nearest projection mapping falls back to nearest neighbor mapping.");
@@ -105,51 +154,22 @@ void NearestProjectionMapping::computeMapping()
     auto                  indexEdges = query::rtree::getEdgeRTree(search_space);
     e2.stop();
 
+    // Search for the origin inside the destination meshes edges
+    pool.parallelFor(0, fVertices.size(), [&](size_t i) {
+      matched[i] = projectOnto(i, indexEdges, tEdges, identity);
+    });
+
     // Lazy evaluation of the vertex index.
     // This is not necessary in the case of matching meshes.
-    query::rtree::vertex_traits::Ptr indexVertices;
-
-    utils::statistics::DistanceAccumulator distanceStatistics;
-
-    std::vector<MatchType> matches;
-    matches.reserve(nnearest);
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      const Eigen::VectorXd &coords = fVertices[i].getCoords();
-      // Search for the origin inside the destination meshes edges
-      matches.clear();
-      indexEdges->query(bg::index::nearest(coords, nnearest),
-                        boost::make_function_output_iterator([&](int match) {
-                          matches.emplace_back(bg::distance(coords, tEdges[match]), match);
-                        }));
-      std::sort(matches.begin(), matches.end());
-      bool found = false;
-      for (const auto &match : matches) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          distanceStatistics(match.distance);
-          found = true;
-          break;
-        }
-      }
-
-      if (not found) {
-        if (!indexVertices) {
-          precice::utils::Event e3(baseEvent + ".getIndexOnVertices", precice::syncMode);
-          indexVertices = query::rtree::getVertexRTree(search_space);
-        }
-        // Search for the origin inside the destination meshes vertices
-        indexVertices->query(bg::index::nearest(coords, 1),
-                             boost::make_function_output_iterator([&](int match) {
-                               _weights[i] = query::generateInterpolationElements(fVertices[i], tVertices[match]);
-                               distanceStatistics(bg::distance(fVertices[i], tVertices[match]));
-                             }));
-      }
-    }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
-    } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
+    collectUnmatched();
+    if (not unmatched.empty()) {
+      precice::utils::Event e3(baseEvent + ".getIndexOnVertices", precice::syncMode);
+      auto                  indexVertices = query::rtree::getVertexRTree(search_space);
+      e3.stop();
+      // Search for the origin inside the destination meshes vertices
+      pool.parallelFor(0, unmatched.size(), [&](size_t u) {
+        projectOntoVertex(unmatched[u], indexVertices);
+      });
     }
   } else {
     const auto &tTriangles = search_space->triangles();
@@ -161,78 +181,61 @@ void NearestProjectionMapping::computeMapping()
     auto                  indexTriangles = query::rtree::getTriangleRTree(search_space);
     e2.stop();
 
+    // Search for the vertex inside the destination meshes triangles
+    pool.parallelFor(0, fVertices.size(), [&](size_t i) {
+      matched[i] = projectOnto(i, indexTriangles, tTriangles, [](query::rtree::triangle_traits::IndexType const &match) { return match.second; });
+    });
+
     // Lazy evaluation of indices for edges and vertices.
     // These are not necessary in the case of matching meshes.
-    query::rtree::edge_traits::Ptr   indexEdges;
-    query::rtree::vertex_traits::Ptr indexVertices;
-
-    utils::statistics::DistanceAccumulator distanceStatistics;
+    collectUnmatched();
+    if (not unmatched.empty()) {
+      precice::utils::Event e3(baseEvent + ".getIndexOnEdges", precice::syncMode);
+      auto                  indexEdges = query::rtree::getEdgeRTree(search_space);
+      e3.stop();
+      // Search for the vertex inside the destination meshes edges
+      pool.parallelFor(0, unmatched.size(), [&](size_t u) {
+        matched[unmatched[u]] = projectOnto(unmatched[u], indexEdges, tEdges, identity);
+      });
+    }
 
-    std::vector<MatchType> matches;
-    matches.reserve(nnearest);
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      const Eigen::VectorXd &coords = fVertices[i].getCoords();
-
-      // Search for the vertex inside the destination meshes triangles
-      matches.clear();
-      indexTriangles->query(bg::index::nearest(coords, nnearest),
-                            boost::make_function_output_iterator([&](query::rtree::triangle_traits::IndexType const &match) {
-                              matches.emplace_back(bg::distance(coords, tTriangles[match.second]), match.second);
-                            }));
-      std::sort(matches.begin(), matches.end());
-      bool found = false;
-      for (const auto &match : matches) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tTriangles[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          found       = true;
-          distanceStatistics(match.distance);
-          break;
-        }
-      }
+    collectUnmatched();
+    if (not unmatched.empty()) {
+      precice::utils::Event e4(baseEvent + ".getIndexOnVertices", precice::syncMode);
+      auto                  indexVertices = query::rtree::getVertexRTree(search_space);
+      e4.stop();
+      // Search for the vertex inside the destination meshes vertices
+      pool.parallelFor(0, unmatched.size(), [&](size_t u) {
+        projectOntoVertex(unmatched[u], indexVertices);
+      });
+    }
+  }
 
-      if (not found) {
-        if (!indexEdges) {
-          precice::utils::Event e3(baseEvent + ".getIndexOnEdges", precice::syncMode);
-          indexEdges = query::rtree::getEdgeRTree(search_space);
-        }
-        // Search for the vertex inside the destination meshes edges
-        matches.clear();
-        indexEdges->query(bg::index::nearest(coords, nnearest),
-                          boost::make_function_output_iterator([&](int match) {
-                            matches.emplace_back(bg::distance(coords, tEdges[match]), match);
-                          }));
-        std::sort(matches.begin(), matches.end());
-        for (const auto &match : matches) {
-          auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
-          if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-            _weights[i] = std::move(weights);
-            found       = true;
-            distanceStatistics(match.distance);
-            break;
-          }
-        }
-      }
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (double distance : distances) {
+    if (distance >= 0.0) { // no match is found in empty meshes
+      distanceStatistics(distance);
+    }
+  }
+  if (distanceStatistics.empty()) {
+    PRECICE_INFO("Mapping distance not available due to empty partition.");
+  } else {
+    PRECICE_INFO("Mapping distance " << distanceStatistics);
+  }
 
-      if (not found) {
-        if (!indexVertices) {
-          precice::utils::Event e4(baseEvent + ".getIndexOnVertices", precice::syncMode);
-          indexVertices = query::rtree::getVertexRTree(search_space);
-        }
-        // Search for the vertex inside the destination meshes vertices
-        indexVertices->query(bg::index::nearest(coords, 1),
-                             boost::make_function_output_iterator([&](int match) {
-                               _weights[i] = query::generateInterpolationElements(fVertices[i], tVertices[match]);
-                               distanceStatistics(bg::distance(fVertices[i], tVertices[match]));
-                             }));
+  // Assemble the interpolation operator, a conservative mapping uses the transposed interpolation
+  std::vector<Eigen::Triplet<double>> entries;
+  for (size_t i = 0; i < weights.size(); ++i) {
+    for (const query::InterpolationElement &elem : weights[i]) {
+      if (getConstraint() == CONSISTENT) {
+        entries.emplace_back(i, elem.element->getID(), elem.weight);
+      } else {
+        entries.emplace_back(elem.element->getID(), i, elem.weight);
       }
     }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
-    } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
-    }
   }
+  _operator.resize(output()->vertices().size(), input()->vertices().size());
+  _operator.setFromTriplets(entries.begin(), entries.end());
   _hasComputedMapping = true;
 }
 
@@ -244,7 +247,7 @@ bool NearestProjectionMapping::hasComputedMapping() const
 void NearestProjectionMapping::clear()
 {
   PRECICE_TRACE();
-  _weights.clear();
+  _operator           = Eigen::SparseMatrix<double, Eigen::RowMajor>();
   _hasComputedMapping = false;
 }
 
@@ -263,43 +266,68 @@ void NearestProjectionMapping::map(
   //assign(outValues) = 0.0;
   int dimensions = inData->getDimensions();
   PRECICE_ASSERT(dimensions == outData->getDimensions());
+  PRECICE_ASSERT(_operator.rows() * dimensions == outValues.size(), _operator.rows(), dimensions, outValues.size());
+  PRECICE_ASSERT(_operator.cols() * dimensions == inValues.size(), _operator.cols(), dimensions, inValues.size());
 
-  if (getConstraint() == CONSISTENT) {
-    PRECICE_DEBUG("Map consistent");
-    PRECICE_ASSERT(_weights.size() == output()->vertices().size(),
-                   _weights.size(), output()->vertices().size());
-    for (size_t i = 0; i < output()->vertices().size(); i++) {
-      InterpolationElements &elems     = _weights[i];
-      size_t                 outOffset = i * dimensions;
-      for (query::InterpolationElement &elem : elems) {
-        size_t inOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
-  } else {
-    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
-    PRECICE_DEBUG("Map conservative");
-    PRECICE_ASSERT(_weights.size() == input()->vertices().size(),
-                   _weights.size(), input()->vertices().size());
-    for (size_t i = 0; i < input()->vertices().size(); i++) {
-      size_t                 inOffset = i * dimensions;
-      InterpolationElements &elems    = _weights[i];
-      for (query::InterpolationElement &elem : elems) {
-        size_t outOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+  PRECICE_DEBUG((getConstraint() == CONSISTENT ? "Map consistent" : "Map conservative"));
+  applyOperator(inValues.data(), outValues.data(), dimensions);
+}
+
+void NearestProjectionMapping::mapBatch(
+    const std::vector<int> &inputDataIDs,
+    const std::vector<int> &outputDataIDs)
+{
+  PRECICE_TRACE(inputDataIDs.size());
+  PRECICE_ASSERT(inputDataIDs.size() == outputDataIDs.size(), inputDataIDs.size(), outputDataIDs.size());
+  if (inputDataIDs.size() == 1) {
+    map(inputDataIDs.front(), outputDataIDs.front());
+    return;
+  }
+
+  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  int columns = 0;
+  for (int inputDataID : inputDataIDs) {
+    columns += input()->data(inputDataID)->getDimensions();
+  }
+
+  // Gather all data fields as columns of one matrix
+  ValueMatrix inMatrix(_operator.cols(), columns);
+  for (size_t k = 0, column = 0; k < inputDataIDs.size(); ++k) {
+    const mesh::PtrData &inData = input()->data(inputDataIDs[k]);
+    const int            dim    = inData->getDimensions();
+    PRECICE_ASSERT(dim == output()->data(outputDataIDs[k])->getDimensions());
+    inMatrix.middleCols(column, dim) = Eigen::Map<const ValueMatrix>(inData->values().data(), _operator.cols(), dim);
+    column += dim;
+  }
+
+  ValueMatrix outMatrix = ValueMatrix::Zero(_operator.rows(), columns);
+  applyOperator(inMatrix.data(), outMatrix.data(), columns);
+
+  for (size_t k = 0, column = 0; k < outputDataIDs.size(); ++k) {
+    const mesh::PtrData &outData = output()->data(outputDataIDs[k]);
+    const int            dim     = outData->getDimensions();
+    Eigen::Map<ValueMatrix>(outData->values().data(), _operator.rows(), dim) += outMatrix.middleCols(column, dim);
+    column += dim;
   }
 }
 
+void NearestProjectionMapping::applyOperator(const double *inputValues, double *outputValues, int columns) const
+{
+  Eigen::Map<const ValueMatrix> in(inputValues, _operator.cols(), columns);
+  Eigen::Map<ValueMatrix>       out(outputValues, _operator.rows(), columns);
+
+  // Every block of rows is a separate sparse matrix-dense matrix product
+  constexpr Eigen::Index blockSize = 4096;
+  const Eigen::Index     rows      = _operator.rows();
+  const Eigen::Index     blocks    = (rows + blockSize - 1) / blockSize;
+  utils::ThreadPool::instance().parallelFor(0, blocks, [&](Eigen::Index block) {
+    const Eigen::Index begin = block * blockSize;
+    const Eigen::Index size  = std::min(blockSize, rows - begin);
+    out.middleRows(begin, size).noalias() += _operator.middleRows(begin, size) * in;
+  });
+}
+
 void NearestProjectionMapping::tagMeshFirstRound()
 {
   PRECICE_TRACE();
@@ -318,30 +346,23 @@ void NearestProjectionMapping::tagMeshFirstRound()
     origins = output();
   }
 
-  // Gather all vertices to be tagged in a first phase.
-  // max_count is used to shortcut if all vertices have been tagged.
-  std::unordered_set<mesh::Vertex const *> tagged;
-  const std::size_t                        max_count = origins->vertices().size();
-
-  for (const InterpolationElements &elems : _weights) {
-    for (const query::InterpolationElement &elem : elems) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.element);
+  // Tag all vertices which contribute to the interpolation, which are the columns of
+  // the operator for a consistent mapping and the rows for a conservative mapping.
+  std::vector<bool> tagged(origins->vertices().size(), false);
+  for (Eigen::Index row = 0; row < _operator.outerSize(); ++row) {
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(_operator, row); it; ++it) {
+      if (!math::equals(it.value(), 0.0)) {
+        tagged[getConstraint() == CONSISTENT ? it.col() : it.row()] = true;
       }
     }
-    // Shortcut if all vertices are tagged
-    if (tagged.size() == max_count) {
-      break;
-    }
   }
 
-  // Now tag all vertices to be tagged in the second phase.
   for (auto &v : origins->vertices()) {
-    if (tagged.count(&v) == 1) {
+    if (tagged[v.getID()]) {
       v.tag();
     }
   }
-  PRECICE_DEBUG("First Round Tagged " << tagged.size() << "/" << max_count << " Vertices");
+  PRECICE_DEBUG("First Round Tagged " << std::count(tagged.begin(), tagged.end(), true) << "/" << origins->vertices().size() << " Vertices");
 
   clear();
 }
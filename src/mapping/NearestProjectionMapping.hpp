@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <list>
 #include <string>
 #include <vector>
@@ -43,6 +45,11 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Maps several data fields at once, traversing the interpolation operator only once.
+  virtual void mapBatch(
+      const std::vector<int> &inputDataIDs,
+      const std::vector<int> &outputDataIDs) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -50,7 +57,15 @@ private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
   using InterpolationElements = std::vector<query::InterpolationElement>;
-  std::vector<InterpolationElements> _weights;
+
+  /// Data values of a mesh with one row per vertex and one column per component
+  using ValueMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /// Interpolation operator in CSR format, rows are output vertices and columns are input vertices
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _operator;
+
+  /// Adds the interpolation operator applied to the input values to the output values.
+  void applyOperator(const double *inputValues, double *outputValues, int columns) const;
 
   bool _hasComputedMapping = false;
 };
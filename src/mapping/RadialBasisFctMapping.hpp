@@ -4,6 +4,11 @@
 
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include <boost/version.hpp>
 #if BOOST_VERSION < 106600
@@ -21,6 +26,7 @@
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -37,6 +43,10 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * For basis functions with compact support, the matrices are assembled as sparse
+ * matrices using a spatial index of the input mesh and the interpolation matrix is
+ * factorized by a sparse LU decomposition.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping {
@@ -69,6 +79,9 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps several data fields at once, using one solve with a right-hand side column per data component.
+  virtual void mapBatch(const std::vector<int> &inputDataIDs, const std::vector<int> &outputDataIDs) override;
+
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
@@ -85,11 +98,32 @@ private:
 
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
 
+  /// Sparse counterpart of _matrixA, used for basis functions with compact support
+  Eigen::SparseMatrix<double> _sparseMatrixA;
+
+  /// Sparse counterpart of _qr, used for basis functions with compact support
+  std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> _sparseLU;
+
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
-  void mapConservative(int inputDataID, int outputDataID, int polyparams);
-  void mapConsistent(int inputDataID, int outputDataID, int polyparams);
+  void mapConservative(const std::vector<int> &inputDataIDs, const std::vector<int> &outputDataIDs, int polyparams);
+  void mapConsistent(const std::vector<int> &inputDataIDs, const std::vector<int> &outputDataIDs, int polyparams);
+
+  /// Returns the amount of rows of the evaluation matrix, i.e., the size of the output mesh
+  Eigen::Index evaluationRows() const;
+
+  /// Returns the size of the interpolation system, i.e., the size of the input mesh plus the polynomial
+  Eigen::Index systemSize() const;
+
+  /// Solves the interpolation system using the factorization computed in computeMapping()
+  Eigen::MatrixXd solveSystem(const Eigen::MatrixXd &rhs) const;
+
+  /// Multiplies the evaluation matrix with the given coefficients
+  Eigen::MatrixXd evaluate(const Eigen::MatrixXd &coefficients) const;
+
+  /// Multiplies the transposed evaluation matrix with the given values
+  Eigen::MatrixXd evaluateTransposed(const Eigen::MatrixXd &values) const;
 
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -192,10 +226,19 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
       globalOutMesh.addMesh(*outMesh);
     }
 
-    _matrixA = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
-    _qr      = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis).colPivHouseholderQr();
+    bool invertible = false;
+    if (_basisFunction.hasCompactSupport()) {
+      _sparseMatrixA = buildSparseMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
+      _sparseLU.reset(new Eigen::SparseLU<Eigen::SparseMatrix<double>>());
+      _sparseLU->compute(buildSparseMatrixCLU(_basisFunction, globalInMesh, _deadAxis));
+      invertible = _sparseLU->info() == Eigen::Success;
+    } else {
+      _matrixA   = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
+      _qr        = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis).colPivHouseholderQr();
+      invertible = _qr.isInvertible();
+    }
 
-    if (not _qr.isInvertible()) {
+    if (not invertible) {
       PRECICE_ERROR("The interpolation matrix of the RBF mapping from mesh " << input()->getName() << " to mesh "
                                                                              << output()->getName() << " is not invertable. This means that the mapping problem is not well-posed. "
                                                                              << "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
@@ -218,6 +261,8 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
   PRECICE_TRACE();
   _matrixA            = Eigen::MatrixXd();
   _qr                 = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseMatrixA      = Eigen::SparseMatrix<double>();
+  _sparseLU.reset();
   _hasComputedMapping = false;
 }
 
@@ -227,6 +272,15 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
     int outputDataID)
 {
   PRECICE_TRACE(inputDataID, outputDataID);
+  mapBatch({inputDataID}, {outputDataID});
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapBatch(
+    const std::vector<int> &inputDataIDs,
+    const std::vector<int> &outputDataIDs)
+{
+  PRECICE_TRACE(inputDataIDs.size());
 
   precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
@@ -235,10 +289,11 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
                  input()->getDimensions(), output()->getDimensions());
   PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
                  getDimensions(), output()->getDimensions());
-  {
-    int valueDim = input()->data(inputDataID)->getDimensions();
-    PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
-                   valueDim, output()->data(outputDataID)->getDimensions());
+  PRECICE_ASSERT(inputDataIDs.size() == outputDataIDs.size(), inputDataIDs.size(), outputDataIDs.size());
+  for (size_t k = 0; k < inputDataIDs.size(); ++k) {
+    int valueDim = input()->data(inputDataIDs[k])->getDimensions();
+    PRECICE_ASSERT(valueDim == output()->data(outputDataIDs[k])->getDimensions(),
+                   valueDim, output()->data(outputDataIDs[k])->getDimensions());
   }
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
@@ -248,228 +303,287 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
   int polyparams = 1 + getDimensions() - deadDimensions;
 
   if (getConstraint() == CONSERVATIVE) {
-    mapConservative(inputDataID, outputDataID, polyparams);
+    mapConservative(inputDataIDs, outputDataIDs, polyparams);
   } else if (getConstraint() == CONSISTENT) {
-    mapConsistent(inputDataID, outputDataID, polyparams);
+    mapConsistent(inputDataIDs, outputDataIDs, polyparams);
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDataID, int outputDataID, int polyparams)
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(const std::vector<int> &inputDataIDs, const std::vector<int> &outputDataIDs, int polyparams)
 {
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
+  PRECICE_TRACE(inputDataIDs.size(), polyparams);
+
+  const size_t batchSize = inputDataIDs.size();
+
+  int localOutputSize = 0;
+  for (const auto &vertex : output()->vertices()) {
+    if (vertex.isOwner()) {
+      ++localOutputSize;
+    }
+  }
 
   // Gather input data
   if (utils::MasterSlave::isSlave()) {
 
-    const auto &localInData = input()->data(inputDataID)->values();
+    for (size_t k = 0; k < batchSize; ++k) {
+      const auto &localInData = input()->data(inputDataIDs[k])->values();
 
-    int localOutputSize = 0;
-    for (const auto &vertex : output()->vertices()) {
-      if (vertex.isOwner()) {
-        ++localOutputSize;
-      }
+      utils::MasterSlave::_communication->send(localInData.data(), localInData.size(), 0);
+      utils::MasterSlave::_communication->send(localOutputSize * output()->data(outputDataIDs[k])->getDimensions(), 0);
     }
 
-    localOutputSize *= output()->data(outputDataID)->getDimensions();
+  } else { // Parallel Master or Serial case
 
-    utils::MasterSlave::_communication->send(localInData.data(), localInData.size(), 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
+    // The right-hand side holds one column per data component
+    int columns = 0;
+    for (size_t k = 0; k < batchSize; ++k) {
+      columns += output()->data(outputDataIDs[k])->getDimensions();
+    }
+    Eigen::MatrixXd               in(evaluationRows(), columns); // rows == outputSize
+    std::vector<std::vector<int>> outputValueSizes(batchSize);
 
-  } else { // Parallel Master or Serial case
+    for (size_t k = 0, column = 0; k < batchSize; ++k) {
+      int valueDim = output()->data(outputDataIDs[k])->getDimensions();
 
-    std::vector<double> globalInValues;
-    std::vector<double> outputValueSizes;
-    {
-      const auto &localInData = input()->data(inputDataID)->values();
-      globalInValues.insert(globalInValues.begin(), localInData.data(), localInData.data() + localInData.size());
+      std::vector<double> globalInValues;
+      {
+        const auto &localInData = input()->data(inputDataIDs[k])->values();
+        globalInValues.insert(globalInValues.begin(), localInData.data(), localInData.data() + localInData.size());
+        outputValueSizes[k].push_back(localOutputSize * valueDim);
+      }
 
-      int localOutputSize = 0;
-      for (const auto &vertex : output()->vertices()) {
-        if (vertex.isOwner()) {
-          ++localOutputSize;
+      {
+        std::vector<double> slaveBuffer;
+        int                 slaveOutputValueSize;
+        for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
+          utils::MasterSlave::_communication->receive(slaveBuffer, rank);
+          globalInValues.insert(globalInValues.end(), slaveBuffer.begin(), slaveBuffer.end());
+
+          utils::MasterSlave::_communication->receive(slaveOutputValueSize, rank);
+          outputValueSizes[k].push_back(slaveOutputValueSize);
         }
       }
 
-      localOutputSize *= output()->data(outputDataID)->getDimensions();
-
-      outputValueSizes.push_back(localOutputSize);
-    }
-
-    {
-      std::vector<double> slaveBuffer;
-      int                 slaveOutputValueSize;
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        globalInValues.insert(globalInValues.end(), slaveBuffer.begin(), slaveBuffer.end());
-
-        utils::MasterSlave::_communication->receive(slaveOutputValueSize, rank);
-        outputValueSizes.push_back(slaveOutputValueSize);
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < in.rows(); i++) { // Fill input data values
+          in(i, column + dim) = globalInValues[i * valueDim + dim];
+        }
       }
+      column += valueDim;
     }
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
+    Eigen::MatrixXd Au  = evaluateTransposed(in); // rows == n
+    Eigen::MatrixXd out = solveSystem(Au);        // rows == n
 
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-    Eigen::VectorXd             outputValues((_matrixA.cols() - polyparams) * valueDim);
-    outputValues.setZero();
+    for (size_t k = 0, column = 0; k < batchSize; ++k) {
+      int  valueDim   = output()->data(outputDataIDs[k])->getDimensions();
+      auto outputData = output()->data(outputDataIDs[k]);
 
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
+      Eigen::VectorXd outputValues((systemSize() - polyparams) * valueDim);
 
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inputValues(i * valueDim + dim);
+      // Copy mapped data to output data values
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < out.rows() - polyparams; i++) {
+          outputValues[i * valueDim + dim] = out(i, column + dim);
+        }
       }
+      column += valueDim;
 
-      Au  = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
+      // Data scattering to slaves
+      if (utils::MasterSlave::isMaster()) {
+
+        // Filter data
+        int outputCounter = 0;
+        for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
+          if (output()->vertices()[i].isOwner()) {
+            for (int dim = 0; dim < valueDim; ++dim) {
+              outputData->values()[i * valueDim + dim] = outputValues(outputCounter);
+              ++outputCounter;
+            }
+          }
+        }
 
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size() - polyparams; i++) {
-        outputValues[i * valueDim + dim] = out[i];
+        // Data scattering to slaves
+        int beginPoint = outputValueSizes[k].at(0);
+        for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
+          utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outputValueSizes[k].at(rank), rank);
+          beginPoint += outputValueSizes[k].at(rank);
+        }
+      } else { // Serial
+        outputData->values() = outputValues;
       }
     }
+  }
+  if (utils::MasterSlave::isSlave()) {
+    for (size_t k = 0; k < batchSize; ++k) {
+      std::vector<double> receivedValues;
+      utils::MasterSlave::_communication->receive(receivedValues, 0);
 
-    // Data scattering to slaves
-    if (utils::MasterSlave::isMaster()) {
+      int valueDim = output()->data(outputDataIDs[k])->getDimensions();
 
-      // Filter data
       int outputCounter = 0;
       for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
         if (output()->vertices()[i].isOwner()) {
           for (int dim = 0; dim < valueDim; ++dim) {
-            output()->data(outputDataID)->values()[i * valueDim + dim] = outputValues(outputCounter);
+            output()->data(outputDataIDs[k])->values()[i * valueDim + dim] = receivedValues.at(outputCounter);
             ++outputCounter;
           }
         }
       }
-
-      // Data scattering to slaves
-      int beginPoint = outputValueSizes.at(0);
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outputValueSizes.at(rank), rank);
-        beginPoint += outputValueSizes.at(rank);
-      }
-    } else { // Serial
-      output()->data(outputDataID)->values() = outputValues;
-    }
-  }
-  if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
-
-    int valueDim = output()->data(outputDataID)->getDimensions();
-
-    int outputCounter = 0;
-    for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
-      if (output()->vertices()[i].isOwner()) {
-        for (int dim = 0; dim < valueDim; ++dim) {
-          output()->data(outputDataID)->values()[i * valueDim + dim] = receivedValues.at(outputCounter);
-          ++outputCounter;
-        }
-      }
     }
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(int inputDataID, int outputDataID, int polyparams)
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const std::vector<int> &inputDataIDs, const std::vector<int> &outputDataIDs, int polyparams)
 {
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
+  PRECICE_TRACE(inputDataIDs.size(), polyparams);
+
+  const size_t batchSize = inputDataIDs.size();
 
   // Gather input data
   if (utils::MasterSlave::isSlave()) {
-    // Input data is filtered
-    auto localInDataFiltered = input()->getOwnedVertexData(inputDataID);
-    int  localOutputSize     = output()->data(outputDataID)->values().size();
-
-    // Send data and output size
-    utils::MasterSlave::_communication->send(localInDataFiltered.data(), localInDataFiltered.size(), 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
+    for (size_t k = 0; k < batchSize; ++k) {
+      // Input data is filtered
+      auto localInDataFiltered = input()->getOwnedVertexData(inputDataIDs[k]);
+      int  localOutputSize     = output()->data(outputDataIDs[k])->values().size();
+
+      // Send data and output size
+      utils::MasterSlave::_communication->send(localInDataFiltered.data(), localInDataFiltered.size(), 0);
+      utils::MasterSlave::_communication->send(localOutputSize, 0);
+    }
 
   } else { // Master or Serial case
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
+    // The right-hand side holds one column per data component (last polyparams rows remain zero)
+    int columns = 0;
+    for (size_t k = 0; k < batchSize; ++k) {
+      columns += output()->data(outputDataIDs[k])->getDimensions();
+    }
+    Eigen::MatrixXd               in = Eigen::MatrixXd::Zero(systemSize(), columns); // rows == n
+    std::vector<std::vector<int>> outValuesSizes(batchSize);
 
-    std::vector<double> globalInValues((_matrixA.cols() - polyparams) * valueDim, 0.0);
-    std::vector<int>    outValuesSize;
+    for (size_t k = 0, column = 0; k < batchSize; ++k) {
+      int valueDim = output()->data(outputDataIDs[k])->getDimensions();
 
-    if (utils::MasterSlave::isMaster()) { // Parallel case
+      std::vector<double> globalInValues((systemSize() - polyparams) * valueDim, 0.0);
 
-      // Filter input data
-      const auto &localInData = input()->getOwnedVertexData(inputDataID);
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
+      if (utils::MasterSlave::isMaster()) { // Parallel case
 
-      int inputSizeCounter = localInData.size();
-      int slaveOutDataSize{0};
+        // Filter input data
+        const auto &localInData = input()->getOwnedVertexData(inputDataIDs[k]);
+        std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
+        outValuesSizes[k].push_back(output()->data(outputDataIDs[k])->values().size());
 
-      std::vector<double> slaveBuffer;
+        int inputSizeCounter = localInData.size();
+        int slaveOutDataSize{0};
 
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        std::copy(slaveBuffer.begin(), slaveBuffer.end(), globalInValues.begin() + inputSizeCounter);
-        inputSizeCounter += slaveBuffer.size();
+        std::vector<double> slaveBuffer;
 
-        utils::MasterSlave::_communication->receive(slaveOutDataSize, rank);
-        outValuesSize.push_back(slaveOutDataSize);
-      }
+        for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
+          utils::MasterSlave::_communication->receive(slaveBuffer, rank);
+          std::copy(slaveBuffer.begin(), slaveBuffer.end(), globalInValues.begin() + inputSizeCounter);
+          inputSizeCounter += slaveBuffer.size();
 
-    } else { // Serial case
-      const auto &localInData = input()->data(inputDataID)->values();
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
-    }
+          utils::MasterSlave::_communication->receive(slaveOutDataSize, rank);
+          outValuesSizes[k].push_back(slaveOutDataSize);
+        }
 
-    Eigen::VectorXd p(_matrixA.cols());   // rows == n
-    Eigen::VectorXd in(_matrixA.cols());  // rows == n
-    Eigen::VectorXd out(_matrixA.rows()); // rows == outputSize
-    in.setZero();
+      } else { // Serial case
+        const auto &localInData = input()->data(inputDataIDs[k])->values();
+        std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
+        outValuesSizes[k].push_back(output()->data(outputDataIDs[k])->values().size());
+      }
 
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
+      // Fill input from input data values
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < in.rows() - polyparams; i++) {
+          in(i, column + dim) = globalInValues[i * valueDim + dim];
+        }
+      }
+      column += valueDim;
+    }
 
-    Eigen::VectorXd outputValues((_matrixA.rows()) * valueDim);
-    outputValues.setZero();
+    // Perform the mapping for all data components at once
+    Eigen::MatrixXd p   = solveSystem(in); // rows == n
+    Eigen::MatrixXd out = evaluate(p);     // rows == outputSize
 
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inputValues[i * valueDim + dim];
-      }
+    for (size_t k = 0, column = 0; k < batchSize; ++k) {
+      int valueDim = output()->data(outputDataIDs[k])->getDimensions();
 
-      p   = _qr.solve(in);
-      out = _matrixA * p;
+      Eigen::VectorXd outputValues(evaluationRows() * valueDim);
 
       // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < out.rows(); i++) {
+          outputValues[i * valueDim + dim] = out(i, column + dim);
+        }
       }
-    }
+      column += valueDim;
 
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
+      output()->data(outputDataIDs[k])->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSizes[k].at(0));
 
-    // Data scattering to slaves
-    int beginPoint = outValuesSize.at(0);
+      // Data scattering to slaves
+      int beginPoint = outValuesSizes[k].at(0);
 
-    if (utils::MasterSlave::isMaster()) {
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outValuesSize.at(rank), rank);
-        beginPoint += outValuesSize.at(rank);
+      if (utils::MasterSlave::isMaster()) {
+        for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
+          utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outValuesSizes[k].at(rank), rank);
+          beginPoint += outValuesSizes[k].at(rank);
+        }
       }
     }
   }
   if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
+    for (size_t k = 0; k < batchSize; ++k) {
+      std::vector<double> receivedValues;
+      utils::MasterSlave::_communication->receive(receivedValues, 0);
+      output()->data(outputDataIDs[k])->values() = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluationRows() const
+{
+  return _basisFunction.hasCompactSupport() ? _sparseMatrixA.rows() : _matrixA.rows();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::systemSize() const
+{
+  return _basisFunction.hasCompactSupport() ? _sparseMatrixA.cols() : _matrixA.cols();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveSystem(const Eigen::MatrixXd &rhs) const
+{
+  if (_basisFunction.hasCompactSupport()) {
+    PRECICE_ASSERT(_sparseLU);
+    return _sparseLU->solve(rhs);
+  }
+  return _qr.solve(rhs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluate(const Eigen::MatrixXd &coefficients) const
+{
+  if (_basisFunction.hasCompactSupport()) {
+    return _sparseMatrixA * coefficients;
+  }
+  return _matrixA * coefficients;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateTransposed(const Eigen::MatrixXd &values) const
+{
+  if (_basisFunction.hasCompactSupport()) {
+    return _sparseMatrixA.transpose() * values;
   }
+  return _matrixA.transpose() * values;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -562,7 +676,8 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
 
-  for (int i = 0; i < inputSize; ++i) {
+  // Rows are filled independently of each other, the cost of a row decreases with its index
+  utils::ThreadPool::instance().parallelForTriangular(0, inputSize, [&](int i) {
     for (int j = i; j < inputSize; ++j) {
       const auto &u   = inputMesh.vertices()[i].getCoords();
       const auto &v   = inputMesh.vertices()[j].getCoords();
@@ -575,7 +690,7 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
       matrixCLU(i, inputSize + 1 + dim) = reduced[dim];
     }
     matrixCLU(i, inputSize) = 1.0;
-  }
+  });
 
   matrixCLU.triangularView<Eigen::Lower>() = matrixCLU.transpose();
 
@@ -602,8 +717,8 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   Eigen::MatrixXd matrixA(outputSize, n);
   matrixA.setZero();
 
-  // Fill _matrixA with values
-  for (int i = 0; i < outputSize; ++i) {
+  // Fill _matrixA with values, rows are filled independently of each other
+  utils::ThreadPool::instance().parallelFor(0, outputSize, [&](int i) {
     for (int j = 0; j < inputSize; ++j) {
       const auto &u = outputMesh.vertices()[i].getCoords();
       const auto &v = inputMesh.vertices()[j].getCoords();
@@ -616,7 +731,133 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
       matrixA(i, inputSize + 1 + dim) = reduced[dim];
     }
     matrixA(i, inputSize) = 1.0;
+  });
+  return matrixA;
+}
+
+/// Returns a box enclosing the support around the given coordinates, which is unbounded along dead axes
+inline query::RTreeBox getSupportBox(const mesh::Vertex::RawCoords &center, double supportRadius, const std::vector<bool> &deadAxis)
+{
+  Eigen::VectorXd lower = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd upper = Eigen::VectorXd::Zero(3);
+  for (int d = 0; d < center.size(); ++d) {
+    if (deadAxis[d]) {
+      lower[d] = std::numeric_limits<double>::lowest();
+      upper[d] = std::numeric_limits<double>::max();
+    } else {
+      lower[d] = center[d] - supportRadius;
+      upper[d] = center[d] + supportRadius;
+    }
+  }
+  return query::RTreeBox{lower, upper};
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double> buildSparseMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, std::vector<bool> deadAxis)
+{
+  PRECICE_ASSERT(basisFunction.hasCompactSupport());
+  int inputSize  = inputMesh.vertices().size();
+  int dimensions = inputMesh.getDimensions();
+
+  int deadDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (deadAxis[d])
+      deadDimensions += 1;
+  }
+
+  int polyparams = 1 + dimensions - deadDimensions;
+  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
+  int n = inputSize + polyparams; // Add linear polynom degrees
+
+  const auto &vertices = inputMesh.vertices();
+  auto        rtree    = query::rtree::createVertexRTree(inputMesh);
+
+  // The entries of every row are collected separately to assemble the rows in parallel
+  std::vector<std::vector<Eigen::Triplet<double>>> rowEntries(inputSize);
+
+  utils::ThreadPool::instance().parallelFor(0, inputSize, [&](int i) {
+    auto &      entries = rowEntries[i];
+    const auto &u       = vertices[i].getCoords();
+    // Only vertices inside the support contribute non-zero entries
+    rtree->query(boost::geometry::index::intersects(getSupportBox(u, basisFunction.getSupportRadius(), deadAxis)),
+                 boost::make_function_output_iterator([&](size_t j) {
+                   const double value = basisFunction.evaluate(utils::reduceVector((u - vertices[j].getCoords()), deadAxis).norm());
+                   if (value != 0.0) {
+                     entries.emplace_back(i, j, value);
+                   }
+                 }));
+
+    const auto reduced = utils::reduceVector(u, deadAxis);
+
+    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
+      entries.emplace_back(i, inputSize + 1 + dim, reduced[dim]);
+      entries.emplace_back(inputSize + 1 + dim, i, reduced[dim]);
+    }
+    entries.emplace_back(i, inputSize, 1.0);
+    entries.emplace_back(inputSize, i, 1.0);
+  });
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const auto &row : rowEntries) {
+    entries.insert(entries.end(), row.begin(), row.end());
   }
+
+  Eigen::SparseMatrix<double> matrixCLU(n, n);
+  matrixCLU.setFromTriplets(entries.begin(), entries.end());
+  return matrixCLU;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double> buildSparseMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const mesh::Mesh &outputMesh, std::vector<bool> deadAxis)
+{
+  PRECICE_ASSERT(basisFunction.hasCompactSupport());
+  int inputSize  = inputMesh.vertices().size();
+  int outputSize = outputMesh.vertices().size();
+  int dimensions = inputMesh.getDimensions();
+
+  int deadDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (deadAxis[d])
+      deadDimensions += 1;
+  }
+
+  int polyparams = 1 + dimensions - deadDimensions;
+  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
+  int n = inputSize + polyparams; // Add linear polynom degrees
+
+  const auto &inVertices = inputMesh.vertices();
+  auto        rtree      = query::rtree::createVertexRTree(inputMesh);
+
+  // The entries of every row are collected separately to assemble the rows in parallel
+  std::vector<std::vector<Eigen::Triplet<double>>> rowEntries(outputSize);
+
+  utils::ThreadPool::instance().parallelFor(0, outputSize, [&](int i) {
+    auto &      entries = rowEntries[i];
+    const auto &u       = outputMesh.vertices()[i].getCoords();
+    // Only vertices inside the support contribute non-zero entries
+    rtree->query(boost::geometry::index::intersects(getSupportBox(u, basisFunction.getSupportRadius(), deadAxis)),
+                 boost::make_function_output_iterator([&](size_t j) {
+                   const double value = basisFunction.evaluate(utils::reduceVector((u - inVertices[j].getCoords()), deadAxis).norm());
+                   if (value != 0.0) {
+                     entries.emplace_back(i, j, value);
+                   }
+                 }));
+
+    const auto reduced = utils::reduceVector(u, deadAxis);
+
+    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
+      entries.emplace_back(i, inputSize + 1 + dim, reduced[dim]);
+    }
+    entries.emplace_back(i, inputSize, 1.0);
+  });
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const auto &row : rowEntries) {
+    entries.insert(entries.end(), row.begin(), row.end());
+  }
+
+  Eigen::SparseMatrix<double> matrixA(outputSize, n);
+  matrixA.setFromTriplets(entries.begin(), entries.end());
   return matrixA;
 }
 
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <utility>
 #include "logging/LogMacros.hpp"
+#include "mapping/LocalRadialBasisFctMapping.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
@@ -54,6 +55,13 @@ MappingConfiguration::MappingConfiguration(
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_QR, false)
                        .setDocumentation("If set to true, QR decomposition is used to solve the RBF system");
+  auto attrLocalized = makeXMLAttribute(ATTR_LOCALIZED, false)
+                           .setDocumentation("If set to true, every vertex is interpolated by a small RBF system over its k nearest vertices of the local mesh partition, "
+                                             "where k is given by vertices-per-cluster. This is not a partition-of-unity method. "
+                                             "It avoids gathering the meshes on the master rank and is used instead of PETSc. "
+                                             "The polynomial is linear per cluster, use-qr-decomposition cannot be combined with this option.");
+  auto attrClusterSize = makeXMLAttribute(ATTR_CLUSTER_SIZE, 25)
+                             .setDocumentation("Amount of vertices used to interpolate a single vertex if localized is set to true.");
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -112,6 +120,8 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrYDead);
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
+    tag.addAttribute(attrLocalized);
+    tag.addAttribute(attrClusterSize);
   }
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
@@ -170,9 +180,11 @@ void MappingConfiguration::xmlTagCallback(
     double        supportRadius  = 0.0;
     double        solverRtol     = 1e-9;
     bool          xDead = false, yDead = false, zDead = false;
-    bool          useLU         = false;
-    Polynomial    polynomial    = Polynomial::ON;
-    Preallocation preallocation = Preallocation::TREE;
+    bool          useLU              = false;
+    bool          localized          = false;
+    int           verticesPerCluster = 25;
+    Polynomial    polynomial         = Polynomial::ON;
+    Preallocation preallocation      = Preallocation::TREE;
 
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)) {
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -195,6 +207,12 @@ void MappingConfiguration::xmlTagCallback(
     if (tag.hasAttribute(ATTR_USE_QR)) {
       useLU = tag.getBooleanAttributeValue(ATTR_USE_QR);
     }
+    if (tag.hasAttribute(ATTR_LOCALIZED)) {
+      localized = tag.getBooleanAttributeValue(ATTR_LOCALIZED);
+    }
+    if (tag.hasAttribute(ATTR_CLUSTER_SIZE)) {
+      verticesPerCluster = tag.getIntAttributeValue(ATTR_CLUSTER_SIZE);
+    }
     if (tag.hasAttribute("polynomial")) {
       std::string strPolynomial = tag.getStringAttributeValue("polynomial");
       if (strPolynomial == "separate")
@@ -223,7 +241,7 @@ void MappingConfiguration::xmlTagCallback(
                                                         fromMesh, toMesh, timing,
                                                         shapeParameter, supportRadius, solverRtol,
                                                         xDead, yDead, zDead,
-                                                        useLU,
+                                                        useLU, localized, verticesPerCluster,
                                                         polynomial, preallocation);
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
@@ -255,6 +273,8 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     bool                             yDead,
     bool                             zDead,
     bool                             useLU,
+    bool                             localized,
+    int                              verticesPerCluster,
     Polynomial                       polynomial,
     Preallocation                    preallocation) const
 {
@@ -316,7 +336,16 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
   usePETSc = true;
 #endif
 
-  if (usePETSc && (not useLU)) {
+  if (localized) {
+    PRECICE_CHECK(not useLU,
+                  "The localized RBF mapping from mesh \"" << fromMeshName << "\" to mesh \"" << toMeshName << "\" always solves its cluster systems "
+                                                           << "using a QR decomposition. Please remove the attribute " << ATTR_USE_QR << ", "
+                                                           << "which selects the global QR-based mapping.");
+    if (usePETSc) {
+      PRECICE_INFO("The localized RBF mapping from mesh \"" << fromMeshName << "\" to mesh \"" << toMeshName << "\" is used instead of the PETSc-based mapping.");
+    }
+    rbfType = RBFType::LOCALIZED;
+  } else if (usePETSc && (not useLU)) {
     rbfType = RBFType::PETSc;
   } else {
     rbfType = RBFType::EIGEN;
@@ -359,6 +388,43 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     }
   }
 
+  if (rbfType == RBFType::LOCALIZED) {
+    PRECICE_DEBUG("Localized RBF is used");
+    if (type == VALUE_RBF_TPS) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<Multiquadrics>(
+              constraintValue, dimensions, Multiquadrics(shapeParameter), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<InverseMultiquadrics>(
+              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_VOLUME_SPLINES) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_GAUSSIAN) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<Gaussian>(
+              constraintValue, dimensions, Gaussian(shapeParameter), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_CTPS_C2) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<CompactThinPlateSplinesC2>(
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<CompactPolynomialC0>(
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
+      configuredMapping.mapping = PtrMapping(
+          new LocalRadialBasisFctMapping<CompactPolynomialC6>(
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), verticesPerCluster, xDead, yDead, zDead, polynomial));
+    } else {
+      PRECICE_ERROR("Unknown mapping type!");
+    }
+  }
+
 #ifndef PRECICE_NO_PETSC
 
   if (rbfType == RBFType::PETSc) {
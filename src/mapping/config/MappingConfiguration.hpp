@@ -32,7 +32,8 @@ enum class Preallocation {
 
 enum class RBFType {
   EIGEN,
-  PETSc
+  PETSc,
+  LOCALIZED
 };
 
 /// Performs XML configuration and holds configured mappings.
@@ -114,6 +115,8 @@ private:
   const std::string ATTR_Y_DEAD         = "y-dead";
   const std::string ATTR_Z_DEAD         = "z-dead";
   const std::string ATTR_USE_QR         = "use-qr-decomposition";
+  const std::string ATTR_LOCALIZED      = "localized";
+  const std::string ATTR_CLUSTER_SIZE   = "vertices-per-cluster";
 
   const std::string VALUE_WRITE        = "write";
   const std::string VALUE_READ         = "read";
@@ -154,6 +157,8 @@ private:
       bool                             yDead,
       bool                             zDead,
       bool                             useLU,
+      bool                             localized,
+      int                              verticesPerCluster,
       Polynomial                       polynomial,
       Preallocation                    preallocation) const;
 
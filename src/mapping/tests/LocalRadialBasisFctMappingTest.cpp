@@ -0,0 +1,284 @@
+#include <Eigen/Core>
+#include <memory>
+#include "logging/Logger.hpp"
+#include "mapping/LocalRadialBasisFctMapping.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(LocalRadialBasisFunctionMapping)
+
+namespace {
+/// Creates a regular 2D grid of n x n vertices on the unit square
+void createGrid2D(mesh::PtrMesh &mesh, int n)
+{
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      mesh->createVertex(Eigen::Vector2d(i / double(n - 1), j / double(n - 1)));
+    }
+  }
+  mesh->allocateDataValues();
+}
+
+/// Maps the linear function 1 + 2x - 3y from a grid to scattered vertices, which has to be reproduced exactly
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testLinearConsistent2D(RADIAL_BASIS_FUNCTION_T fct, Polynomial polynomial)
+{
+  const int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  createGrid2D(inMesh, 6);
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = 1.0 + 2.0 * v.getCoords()[0] - 3.0 * v.getCoords()[1];
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.1));
+  outMesh->createVertex(Eigen::Vector2d(0.55, 0.3));
+  outMesh->createVertex(Eigen::Vector2d(0.9, 0.75));
+  outMesh->createVertex(Eigen::Vector2d(0.0, 1.0));
+  outMesh->allocateDataValues();
+
+  LocalRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> mapping(Mapping::CONSISTENT, dimensions, fct, 12, false, false, false, polynomial);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping() == true);
+  mapping.map(inDataID, outDataID);
+
+  for (const auto &v : outMesh->vertices()) {
+    const double expected = 1.0 + 2.0 * v.getCoords()[0] - 3.0 * v.getCoords()[1];
+    BOOST_TEST(outData->values()(v.getID()) == expected, boost::test_tools::tolerance(1e-8));
+  }
+
+  mapping.clear();
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ConsistentLinear2D)
+{
+  PRECICE_TEST(1_rank);
+  for (Polynomial polynomial : {Polynomial::ON, Polynomial::SEPARATE}) {
+    testLinearConsistent2D(ThinPlateSplines(), polynomial);
+    testLinearConsistent2D(Multiquadrics(0.5), polynomial);
+    testLinearConsistent2D(Gaussian(2.0), polynomial);
+    testLinearConsistent2D(CompactPolynomialC6(1.0), polynomial);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentInterpolates3DVector)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 3;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 2);
+  int           inDataID = inData->getID();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        inMesh->createVertex(Eigen::Vector3d(i, j, k));
+      }
+    }
+  }
+  inMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(2 * v.getID())     = v.getCoords().sum();
+    inData->values()(2 * v.getID() + 1) = v.getCoords().squaredNorm();
+  }
+
+  // The output vertices coincide with input vertices, which has to be interpolated exactly
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 2);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector3d(1, 1, 1));
+  outMesh->createVertex(Eigen::Vector3d(2, 0, 1));
+  outMesh->allocateDataValues();
+
+  for (Polynomial polynomial : {Polynomial::ON, Polynomial::OFF, Polynomial::SEPARATE}) {
+    LocalRadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, dimensions, Gaussian(1.0), 10, false, false, false, polynomial);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inDataID, outDataID);
+
+    Eigen::Vector4d expected(3.0, 3.0, 3.0, 5.0);
+    BOOST_TEST(testing::equals(outData->values(), expected, 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeSum2D)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  inMesh->createVertex(Eigen::Vector2d(0.4, 0.5));
+  inMesh->createVertex(Eigen::Vector2d(0.6, 0.5));
+  inMesh->createVertex(Eigen::Vector2d(0.15, 0.85));
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0, 4.0;
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  createGrid2D(outMesh, 4);
+
+  LocalRadialBasisFctMapping<Multiquadrics> mapping(Mapping::CONSERVATIVE, dimensions, Multiquadrics(0.5), 9, false, false, false);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values().sum() == 7.0, boost::test_tools::tolerance(1e-10));
+
+  // Mapping twice must not accumulate
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values().sum() == 7.0, boost::test_tools::tolerance(1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis3D)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 3;
+
+  // All vertices lie in the plane z = 1, which requires the z-axis to be dead
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      inMesh->createVertex(Eigen::Vector3d(i, j, 1.0));
+    }
+  }
+  inMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = 2.0 * v.getCoords()[0] + v.getCoords()[1];
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector3d(1.5, 0.5, 1.0));
+  outMesh->createVertex(Eigen::Vector3d(2.25, 2.75, 1.0));
+  outMesh->allocateDataValues();
+
+  LocalRadialBasisFctMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, ThinPlateSplines(), 8, false, false, true);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inDataID, outDataID);
+
+  Eigen::Vector2d expected(3.5, 7.25);
+  BOOST_TEST(testing::equals(outData->values(), expected, 1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(TagFirstRound)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  // The remote input mesh, only the vertices used by clusters should be tagged
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  createGrid2D(inMesh, 5);
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  outMesh->allocateDataValues();
+
+  LocalRadialBasisFctMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, ThinPlateSplines(), 4, false, false, false);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.tagMeshFirstRound();
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+
+  int tagged = 0;
+  for (const auto &v : inMesh->vertices()) {
+    if (v.isTagged()) {
+      ++tagged;
+      BOOST_TEST(v.getCoords().norm() <= 0.36);
+    }
+  }
+  BOOST_TEST(tagged == 4);
+}
+
+BOOST_AUTO_TEST_CASE(TagFirstRoundDeadAxis)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  // Every second vertex lies far away along the dead y-axis, which must not influence the clusters
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  for (int i = 0; i < 10; ++i) {
+    inMesh->createVertex(Eigen::Vector2d(i, 5.0 * (i % 2)));
+  }
+  inMesh->allocateDataValues();
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(4.5, 0.0));
+  outMesh->allocateDataValues();
+
+  LocalRadialBasisFctMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, ThinPlateSplines(), 4, false, true, false);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.tagMeshFirstRound();
+
+  for (const auto &v : inMesh->vertices()) {
+    const bool expected = (v.getCoords()[0] >= 3.0 && v.getCoords()[0] <= 6.0);
+    BOOST_TEST(v.isTagged() == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Threads)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData inData = inMesh->createData("InData", 2);
+    createGrid2D(inMesh, 7);
+    inData->values().setLinSpaced(-1.0, 2.0);
+
+    mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData outData = outMesh->createData("OutData", 2);
+    for (int i = 0; i < 20; ++i) {
+      outMesh->createVertex(Eigen::Vector2d(0.05 * i, 0.1 * ((7 * i) % 10)));
+    }
+    outMesh->allocateDataValues();
+
+    // The results have to be independent of the amount of threads
+    Eigen::VectorXd serial;
+    for (int threads : {1, 3}) {
+      utils::ThreadPool::instance().setThreads(threads);
+      LocalRadialBasisFctMapping<Multiquadrics> mapping(constraint, dimensions, Multiquadrics(0.5), 9, false, false, false);
+      mapping.setMeshes(inMesh, outMesh);
+      mapping.computeMapping();
+      mapping.map(inData->getID(), outData->getID());
+      if (threads == 1) {
+        serial = outData->values();
+      } else {
+        BOOST_TEST(testing::equals(outData->values(), serial));
+      }
+    }
+    if (constraint == Mapping::CONSERVATIVE) {
+      BOOST_TEST(outData->values().sum() == inData->values().sum(), boost::test_tools::tolerance(1e-10));
+    }
+  }
+  utils::ThreadPool::instance().setThreads(1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LocalRadialBasisFunctionMapping
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
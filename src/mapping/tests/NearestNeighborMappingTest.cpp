@@ -11,6 +11,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -166,5 +167,63 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   BOOST_TEST(outValues(1) == 0.0);
 }
 
+BOOST_AUTO_TEST_CASE(MapBatch)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 3;
+
+  // The conservative mapping uses a different kernel, if several threads are available
+  for (int threads : {1, 2}) {
+    utils::ThreadPool::instance().setThreads(threads);
+
+    for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+      // Several vertices of the fine mesh are mapped to the same vertex of the coarse mesh
+      PtrMesh coarseMesh(new Mesh("CoarseMesh", dimensions, false, testing::nextMeshID()));
+      coarseMesh->createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+      coarseMesh->createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+      coarseMesh->createVertex(Eigen::Vector3d(0.0, 1.0, 1.0));
+
+      PtrMesh fineMesh(new Mesh("FineMesh", dimensions, false, testing::nextMeshID()));
+      for (int i = 0; i < 10; ++i) {
+        fineMesh->createVertex(Eigen::Vector3d(0.1 * i, 0.05 * i, 0.1 * (i % 3)));
+      }
+
+      PtrMesh inMesh  = (constraint == mapping::Mapping::CONSISTENT) ? coarseMesh : fineMesh;
+      PtrMesh outMesh = (constraint == mapping::Mapping::CONSISTENT) ? fineMesh : coarseMesh;
+
+      PtrData inScalar        = inMesh->createData("InScalar", 1);
+      PtrData inVector        = inMesh->createData("InVector", 3);
+      PtrData outScalarSingle = outMesh->createData("OutScalarSingle", 1);
+      PtrData outVectorSingle = outMesh->createData("OutVectorSingle", 3);
+      PtrData outScalarBatch  = outMesh->createData("OutScalarBatch", 1);
+      PtrData outVectorBatch  = outMesh->createData("OutVectorBatch", 3);
+      coarseMesh->allocateDataValues();
+      fineMesh->allocateDataValues();
+      inScalar->values().setLinSpaced(1.0, 3.0);
+      inVector->values().setLinSpaced(-2.0, 5.0);
+
+      mapping::NearestNeighborMapping mapping(constraint, dimensions);
+      mapping.setMeshes(inMesh, outMesh);
+      mapping.computeMapping();
+
+      // Mapping all data in one batch has to give the same results as mapping them one by one
+      mapping.map(inScalar->getID(), outScalarSingle->getID());
+      mapping.map(inVector->getID(), outVectorSingle->getID());
+      mapping.mapBatch({inScalar->getID(), inVector->getID()}, {outScalarBatch->getID(), outVectorBatch->getID()});
+
+      BOOST_TEST(testing::equals(outScalarBatch->values(), outScalarSingle->values()));
+      BOOST_TEST(testing::equals(outVectorBatch->values(), outVectorSingle->values()));
+      if (constraint == mapping::Mapping::CONSERVATIVE) {
+        BOOST_TEST(outScalarBatch->values().sum() == inScalar->values().sum(), boost::test_tools::tolerance(1e-12));
+        BOOST_TEST(outVectorBatch->values().sum() == inVector->values().sum(), boost::test_tools::tolerance(1e-12));
+      } else {
+        BOOST_TEST(outScalarBatch->values()(0) == inScalar->values()(0));
+        BOOST_TEST(outVectorBatch->values()(9 * 3 + 2) == inVector->values()(1 * 3 + 2));
+      }
+    }
+  }
+  utils::ThreadPool::instance().setThreads(1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
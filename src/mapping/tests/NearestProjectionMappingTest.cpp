@@ -213,6 +213,57 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental2D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(MapBatch)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  int dimensions = 2;
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    // The edge mesh is the input of a consistent and the output of a conservative mapping
+    PtrMesh edgeMesh(new Mesh("EdgeMesh", dimensions, false, testing::nextMeshID()));
+    Vertex &v1 = edgeMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+    Vertex &v2 = edgeMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+    Vertex &v3 = edgeMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+    edgeMesh->createEdge(v1, v2);
+    edgeMesh->createEdge(v2, v3);
+
+    PtrMesh vertexMesh(new Mesh("VertexMesh", dimensions, false, testing::nextMeshID()));
+    vertexMesh->createVertex(Eigen::Vector2d(0.25, -0.1));
+    vertexMesh->createVertex(Eigen::Vector2d(1.2, 0.5));
+    vertexMesh->createVertex(Eigen::Vector2d(0.9, 0.9));
+    vertexMesh->createVertex(Eigen::Vector2d(2.0, 2.0));
+
+    PtrMesh inMesh  = (constraint == mapping::Mapping::CONSISTENT) ? edgeMesh : vertexMesh;
+    PtrMesh outMesh = (constraint == mapping::Mapping::CONSISTENT) ? vertexMesh : edgeMesh;
+
+    PtrData inScalar        = inMesh->createData("InScalar", 1);
+    PtrData inVector        = inMesh->createData("InVector", 2);
+    PtrData outScalarSingle = outMesh->createData("OutScalarSingle", 1);
+    PtrData outVectorSingle = outMesh->createData("OutVectorSingle", 2);
+    PtrData outScalarBatch  = outMesh->createData("OutScalarBatch", 1);
+    PtrData outVectorBatch  = outMesh->createData("OutVectorBatch", 2);
+    edgeMesh->computeState();
+    edgeMesh->allocateDataValues();
+    vertexMesh->allocateDataValues();
+    inScalar->values().setLinSpaced(1.0, 3.0);
+    inVector->values().setLinSpaced(-2.0, 5.0);
+
+    mapping::NearestProjectionMapping mapping(constraint, dimensions);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+
+    // Mapping all data in one batch has to give the same results as mapping them one by one
+    mapping.map(inScalar->getID(), outScalarSingle->getID());
+    mapping.map(inVector->getID(), outVectorSingle->getID());
+    mapping.mapBatch({inScalar->getID(), inVector->getID()}, {outScalarBatch->getID(), outVectorBatch->getID()});
+
+    BOOST_TEST(testing::equals(outScalarBatch->values(), outScalarSingle->values()));
+    BOOST_TEST(testing::equals(outVectorBatch->values(), outVectorSingle->values()));
+    BOOST_TEST(outScalarBatch->values().sum() > 0.0);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ConsistentNonIncrementalPseudo3D)
 {
   PRECICE_TEST(1_rank);
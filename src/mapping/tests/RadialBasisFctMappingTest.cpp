@@ -1753,6 +1753,97 @@ BOOST_AUTO_TEST_CASE(MapPetCompactPolynomialC6)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapCompactSupportSparse)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 2;
+
+  // The support only covers the direct neighbors of each vertex, such that the system is sparse
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      inMesh->createVertex(Eigen::Vector2d(i, j));
+    }
+  }
+  inMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = 1.0 + 2.0 * v.getCoords()[0] - v.getCoords()[1];
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector2d(2.0, 3.0));
+  outMesh->createVertex(Eigen::Vector2d(4.5, 7.25));
+  outMesh->createVertex(Eigen::Vector2d(9.0, 0.5));
+  outMesh->allocateDataValues();
+
+  CompactPolynomialC6                        fct(1.5);
+  RadialBasisFctMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  mapping.map(inDataID, outDataID);
+
+  // Linear functions are reproduced exactly by the polynomial
+  Eigen::Vector3d expected(2.0, 2.75, 18.5);
+  BOOST_TEST(testing::equals(outData->values(), expected, 1e-10));
+
+  // The factorization is reused when mapping again
+  inData->values() *= 2.0;
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(testing::equals(outData->values(), Eigen::Vector3d(2.0 * expected), 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(MapBatch)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 2;
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData inScalar = inMesh->createData("InScalar", 1);
+    mesh::PtrData inVector = inMesh->createData("InVector", 2);
+    inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+    inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+    inMesh->createVertex(Eigen::Vector2d(0.0, 1.0));
+    inMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+    inMesh->createVertex(Eigen::Vector2d(0.5, 0.6));
+    inMesh->allocateDataValues();
+    inScalar->values() << 1.0, 2.0, 3.0, 4.0, 5.0;
+    inVector->values() << 1.0, -1.0, 2.0, -2.0, 3.0, -3.0, 4.0, -4.0, 5.0, -5.0;
+
+    mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData outScalarSingle = outMesh->createData("OutScalarSingle", 1);
+    mesh::PtrData outVectorSingle = outMesh->createData("OutVectorSingle", 2);
+    mesh::PtrData outScalarBatch  = outMesh->createData("OutScalarBatch", 1);
+    mesh::PtrData outVectorBatch  = outMesh->createData("OutVectorBatch", 2);
+    outMesh->createVertex(Eigen::Vector2d(0.25, 0.25));
+    outMesh->createVertex(Eigen::Vector2d(0.75, 0.5));
+    outMesh->createVertex(Eigen::Vector2d(0.1, 0.9));
+    outMesh->createVertex(Eigen::Vector2d(0.6, 0.9));
+    outMesh->createVertex(Eigen::Vector2d(0.9, 0.1));
+    outMesh->createVertex(Eigen::Vector2d(0.4, 0.0));
+    outMesh->allocateDataValues();
+
+    ThinPlateSplines                        fct;
+    RadialBasisFctMapping<ThinPlateSplines> mapping(constraint, dimensions, fct, false, false, false);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+
+    // Mapping all data in one batch has to give the same results as mapping them one by one
+    mapping.map(inScalar->getID(), outScalarSingle->getID());
+    mapping.map(inVector->getID(), outVectorSingle->getID());
+    mapping.mapBatch({inScalar->getID(), inVector->getID()}, {outScalarBatch->getID(), outVectorBatch->getID()});
+
+    BOOST_TEST(testing::equals(outScalarBatch->values(), outScalarSingle->values()));
+    BOOST_TEST(testing::equals(outVectorBatch->values(), outVectorSingle->values()));
+    BOOST_TEST(outVectorBatch->values().norm() > 0.0);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2)
 {
   PRECICE_TEST(1_rank);
@@ -30,17 +30,21 @@ double Edge::getLength() const
   return length;
 }
 
-const Eigen::VectorXd Edge::computeNormal(bool flip)
+Eigen::Vector2d Edge::computeNormal(bool flip)
 {
-  // Compute normal
-  Eigen::VectorXd edgeVector = vertex(1).getCoords() - vertex(0).getCoords();
-  Eigen::VectorXd normal     = Eigen::Vector2d(-edgeVector[1], edgeVector[0]);
+  PRECICE_ASSERT(getDimensions() == 2, getDimensions());
+  // Fixed-size vectors, as Mesh::computeState() calls this for every edge
+  const Eigen::Vector2d coordsA    = vertex(0).getCoords();
+  const Eigen::Vector2d coordsB    = vertex(1).getCoords();
+  const Eigen::Vector2d center     = 0.5 * (coordsA + coordsB);
+  const Eigen::Vector2d edgeVector = coordsB - coordsA;
+  Eigen::Vector2d       normal(-edgeVector[1], edgeVector[0]);
   if (not flip) {
     normal *= -1.0; // Invert direction if counterclockwise
   }
   _normal = normal.normalized(); // Scale normal vector to length 1
 
-  return normal * getEnclosingRadius() * 2.0; // Weight by length
+  return normal * (coordsA - center).norm() * 2.0; // Weight by length
 }
 
 const Eigen::VectorXd Edge::getCenter() const
@@ -16,6 +16,7 @@
 #include "mesh/Data.hpp"
 #include "query/RTree.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 namespace mesh {
@@ -34,7 +35,7 @@ Mesh::Mesh(
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
 
-  meshChanged.connect([](Mesh &m) { query::rtree::clear(m); });
+  meshChanged.connect([](Mesh &m) { query::rtree::meshChanged(m); });
   meshDestroyed.connect([](Mesh &m) { query::rtree::clear(m); });
 }
 
@@ -121,13 +122,20 @@ PtrData &Mesh::createData(
     const std::string &name,
     int                dimension)
 {
-  PRECICE_TRACE(name, dimension);
+  return createData(name, dimension, Data::getDataCount());
+}
+
+PtrData &Mesh::createData(
+    const std::string &name,
+    int                dimension,
+    int                id)
+{
+  PRECICE_TRACE(name, dimension, id);
   for (const PtrData &data : _data) {
     PRECICE_CHECK(data->getName() != name,
                   "Data \"" << name << "\" cannot be created twice for "
                             << "mesh \"" << _name << "\". Please rename or remove one of the use-data tags with name \"" << name << "\".");
   }
-  int     id = Data::getDataCount();
   PtrData data(new Data(name, id, dimension));
   _data.push_back(data);
   return _data.back();
@@ -211,6 +219,69 @@ void Mesh::computeBoundingBox()
   PRECICE_DEBUG("Bounding Box, " << _boundingBox);
 }
 
+namespace {
+
+/// Normals of a chunk of faces, stored contiguously
+template <int DIM>
+using Normals = std::vector<Eigen::Matrix<double, DIM, 1>, Eigen::aligned_allocator<Eigen::Matrix<double, DIM, 1>>>;
+
+constexpr std::size_t blockSize = 4096;
+
+/// Calls function(begin, end) for blocks of [0, size) using the ThreadPool.
+template <typename Function>
+void forBlocks(std::size_t size, Function function)
+{
+  const std::size_t blocks = (size + blockSize - 1) / blockSize;
+  utils::ThreadPool::instance().parallelFor(0, blocks, [&](std::size_t block) {
+    const std::size_t begin = block * blockSize;
+    function(begin, std::min(begin + blockSize, size));
+  });
+}
+
+/**
+ * @brief Computes the weighted normals of all faces and passes them to accumulate(face, normal).
+ *
+ * The faces are processed in chunks, which fit into the cache. The normals of a chunk are computed in parallel,
+ * then they are accumulated serially in the order of the faces, hence the results do not depend on the amount of threads.
+ */
+template <int DIM, typename Faces, typename ComputeNormal, typename Accumulate>
+void forFaceNormals(Faces &faces, ComputeNormal computeNormal, Accumulate accumulate)
+{
+  constexpr std::size_t chunkSize = 16 * blockSize;
+
+  const std::size_t size = faces.size();
+  Normals<DIM>      normals(std::min(chunkSize, size));
+  for (std::size_t chunk = 0; chunk < size; chunk += chunkSize) {
+    const std::size_t chunkLength = std::min(chunkSize, size - chunk);
+    forBlocks(chunkLength, [&](std::size_t begin, std::size_t end) {
+      auto face = faces.begin() + (chunk + begin);
+      for (std::size_t i = begin; i < end; ++i, ++face) {
+        normals[i] = computeNormal(*face);
+      }
+    });
+    auto face = faces.begin() + chunk;
+    for (std::size_t i = 0; i < chunkLength; ++i, ++face) {
+      accumulate(*face, normals[i]);
+    }
+  }
+}
+
+/// Normalizes the normals of all vertices or edges.
+template <int DIM, typename Entities>
+void normalizeNormals(Entities &entities)
+{
+  forBlocks(entities.size(), [&](std::size_t begin, std::size_t end) {
+    auto entity = entities.begin() + begin;
+    for (std::size_t i = begin; i < end; ++i, ++entity) {
+      const Eigen::Matrix<double, DIM, 1> normal = entity->getNormal();
+      // there can be cases when a vertex or edge has no adjacent face though faces exist in general (e.g. after filtering)
+      entity->setNormal(normal.normalized());
+    }
+  });
+}
+
+} // namespace
+
 void Mesh::computeState()
 {
   PRECICE_TRACE(_name);
@@ -226,50 +297,46 @@ void Mesh::computeState()
     return;
   }
 
-  // Compute (in 2D) edge normals
   if (_dimensions == 2) {
-    for (Edge &edge : _edges) {
-      Eigen::VectorXd weightednormal = edge.computeNormal(_flipNormals);
-
-      // Accumulate normal in associated vertices
-      for (int i = 0; i < 2; i++) {
-        Eigen::VectorXd vertexNormal = edge.vertex(i).getNormal();
-        vertexNormal += weightednormal;
-        edge.vertex(i).setNormal(vertexNormal);
-      }
-    }
+    // Compute (in 2D) edge normals, weighted by length, and accumulate them in associated vertices
+    forFaceNormals<2>(
+        _edges,
+        [this](Edge &edge) { return edge.computeNormal(_flipNormals); },
+        [](Edge &edge, const Eigen::Vector2d &normal) {
+          for (int i = 0; i < 2; i++) {
+            edge.vertex(i).setNormal(edge.vertex(i).getNormal() + normal);
+          }
+        });
   }
 
   if (_dimensions == 3) {
-    // Compute normals
-    for (Triangle &triangle : _triangles) {
-      PRECICE_ASSERT(triangle.vertex(0) != triangle.vertex(1),
-                     triangle.vertex(0), triangle.getID());
-      PRECICE_ASSERT(triangle.vertex(1) != triangle.vertex(2),
-                     triangle.vertex(1), triangle.getID());
-      PRECICE_ASSERT(triangle.vertex(2) != triangle.vertex(0),
-                     triangle.vertex(2), triangle.getID());
-
-      // Compute normals
-      Eigen::VectorXd weightednormal = triangle.computeNormal(_flipNormals);
-
-      // Accumulate area-weighted normal in associated vertices and edges
-      for (int i = 0; i < 3; i++) {
-        triangle.edge(i).setNormal(triangle.edge(i).getNormal() + weightednormal);
-        triangle.vertex(i).setNormal(triangle.vertex(i).getNormal() + weightednormal);
-      }
-    }
+    // Compute area-weighted triangle normals and accumulate them in associated vertices and edges
+    forFaceNormals<3>(
+        _triangles,
+        [this](Triangle &triangle) {
+          PRECICE_ASSERT(triangle.vertex(0) != triangle.vertex(1),
+                         triangle.vertex(0), triangle.getID());
+          PRECICE_ASSERT(triangle.vertex(1) != triangle.vertex(2),
+                         triangle.vertex(1), triangle.getID());
+          PRECICE_ASSERT(triangle.vertex(2) != triangle.vertex(0),
+                         triangle.vertex(2), triangle.getID());
+          return triangle.computeNormal(_flipNormals);
+        },
+        [](Triangle &triangle, const Eigen::Vector3d &normal) {
+          for (int i = 0; i < 3; i++) {
+            triangle.edge(i).setNormal(triangle.edge(i).getNormal() + normal);
+            triangle.vertex(i).setNormal(triangle.vertex(i).getNormal() + normal);
+          }
+        });
 
     // Normalize edge normals (only done in 3D)
-    for (Edge &edge : _edges) {
-      // there can be cases when an edge has no adjacent triangle though triangles exist in general (e.g. after filtering)
-      edge.setNormal(edge.getNormal().normalized());
-    }
+    normalizeNormals<3>(_edges);
   }
 
-  for (Vertex &vertex : _vertices) {
-    // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
-    vertex.setNormal(vertex.getNormal().normalized());
+  if (_dimensions == 2) {
+    normalizeNormals<2>(_vertices);
+  } else {
+    normalizeNormals<3>(_vertices);
   }
 }
 
@@ -360,10 +427,8 @@ void Mesh::addMesh(
 
   boost::container::flat_map<int, Vertex *> vertexMap;
   vertexMap.reserve(deltaMesh.vertices().size());
-  Eigen::VectorXd coords(_dimensions);
   for (const Vertex &vertex : deltaMesh.vertices()) {
-    coords    = vertex.getCoords();
-    Vertex &v = createVertex(coords);
+    Vertex &v = createVertex(vertex.getCoords());
     v.setGlobalIndex(vertex.getGlobalIndex());
     if (vertex.isTagged())
       v.tag();
@@ -137,6 +137,12 @@ public:
       const std::string &name,
       int                dimension);
 
+  /// Creates a data set with the given ID instead of a new one, e.g., for copies of a mesh.
+  PtrData &createData(
+      const std::string &name,
+      int                dimension,
+      int                id);
+
   const DataContainer &data() const;
 
   const PtrData &data(int dataID) const;
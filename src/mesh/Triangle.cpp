@@ -3,6 +3,7 @@
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 #include <algorithm>
+#include <array>
 #include <boost/concept/assert.hpp>
 #include <boost/range/concepts.hpp>
 #include "math/differences.hpp"
@@ -84,12 +85,18 @@ double Triangle::getArea() const
   return (0.5 * normal.norm());
 }
 
-const Eigen::VectorXd Triangle::computeNormal(bool flip)
+Eigen::Vector3d Triangle::computeNormal(bool flip)
 {
-  Eigen::Vector3d vectorA = edge(1).getCenter() - edge(0).getCenter();
-  Eigen::Vector3d vectorB = edge(2).getCenter() - edge(0).getCenter();
+  // Fixed-size vectors, as Mesh::computeState() calls this for every triangle
+  std::array<Eigen::Vector3d, 3> centers;
+  for (int i = 0; i < 3; ++i) {
+    centers[i] = 0.5 * (edge(i).vertex(0).getCoords() + edge(i).vertex(1).getCoords());
+  }
+  // Named vectors, as the cross product of expressions is evaluated slowly
+  const Eigen::Vector3d vectorA = centers[1] - centers[0];
+  const Eigen::Vector3d vectorB = centers[2] - centers[0];
   // Compute cross-product of vector A and vector B
-  auto normal = vectorA.cross(vectorB);
+  Eigen::Vector3d normal = vectorA.cross(vectorB);
   if (flip) {
     normal *= -1.0; // Invert direction if counterclockwise
   }
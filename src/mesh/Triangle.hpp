@@ -29,13 +29,13 @@ public:
    * The returned value is the forwarded result of Vertex::getCoords.
    * It is thus a read-only random-access iterator.
    */
-  using const_iterator = IndexRangeIterator<const Triangle, const Eigen::VectorXd>;
+  using const_iterator = IndexRangeIterator<const Triangle, const Vertex::RawCoords>;
 
   /// Type of the read-only random access vertex iterator
   using iterator = const_iterator;
 
   /// Fix for the Boost.Test versions 1.65.1 - 1.67
-  using value_type = Eigen::VectorXd;
+  using value_type = Vertex::RawCoords;
 
   /// Constructor, the order of edges defines the outer normal direction.
   Triangle(
@@ -98,8 +98,8 @@ public:
   template <typename VECTOR_T>
   void setNormal(const VECTOR_T &normal);
 
-  /// Computes and sets the normal of the triangle, returns the area-weighted normal.
-  const Eigen::VectorXd computeNormal(bool flip = false);
+  /// Computes and sets the normal of the 3D triangle, returns the area-weighted normal.
+  Eigen::Vector3d computeNormal(bool flip = false);
 
   /// Returns a among triangles globally unique ID.
   int getID() const;
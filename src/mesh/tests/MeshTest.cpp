@@ -1,6 +1,7 @@
 #include <Eigen/Core>
 #include <Eigen/src/Core/Matrix.h>
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <iosfwd>
 #include <memory>
@@ -17,6 +18,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/algorithm.hpp"
 
 using namespace precice;
@@ -432,6 +434,66 @@ BOOST_AUTO_TEST_CASE(ComputeStateOfNotFullyConnectedMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ComputeStateWithThreads)
+{
+  PRECICE_TEST(1_rank);
+  // A curved grid of 80 x 80 vertices, which spans several blocks of vertices, edges and triangles
+  constexpr int n         = 80;
+  auto          buildMesh = [](Mesh &mesh) {
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        mesh.createVertex(Vector3d(i, j, std::sin(0.1 * i) * std::cos(0.2 * j)));
+      }
+    }
+    auto &              vertices = mesh.vertices();
+    std::vector<Edge *> alongI, alongJ;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        alongI.push_back(i + 1 < n ? &mesh.createEdge(vertices[i * n + j], vertices[(i + 1) * n + j]) : nullptr);
+        alongJ.push_back(j + 1 < n ? &mesh.createEdge(vertices[i * n + j], vertices[i * n + j + 1]) : nullptr);
+      }
+    }
+    for (int i = 0; i + 1 < n; ++i) {
+      for (int j = 0; j + 1 < n; ++j) {
+        Edge &diagonal = mesh.createEdge(vertices[i * n + j], vertices[(i + 1) * n + j + 1]);
+        mesh.createTriangle(*alongI[i * n + j], *alongJ[(i + 1) * n + j], diagonal);
+        mesh.createTriangle(diagonal, *alongI[i * n + j + 1], *alongJ[i * n + j]);
+      }
+    }
+  };
+
+  // Reference using the normals computed by the triangles
+  Mesh reference("Reference", 3, false, testing::nextMeshID());
+  buildMesh(reference);
+  std::vector<Vector3d> vertexNormals(reference.vertices().size(), Vector3d::Zero());
+  std::vector<Vector3d> edgeNormals(reference.edges().size(), Vector3d::Zero());
+  for (auto &triangle : reference.triangles()) {
+    const Vector3d weightedNormal = triangle.computeNormal();
+    for (int i = 0; i < 3; ++i) {
+      vertexNormals[triangle.vertex(i).getID()] += weightedNormal;
+      edgeNormals[triangle.edge(i).getID()] += weightedNormal;
+    }
+  }
+
+  for (int threads : {1, 3}) {
+    utils::ThreadPool::instance().setThreads(threads);
+    Mesh mesh("Mesh", 3, false, testing::nextMeshID());
+    buildMesh(mesh);
+    mesh.computeState();
+    for (const auto &vertex : mesh.vertices()) {
+      BOOST_TEST(equals(vertex.getNormal(), vertexNormals[vertex.getID()].normalized()));
+    }
+    for (const auto &edge : mesh.edges()) {
+      BOOST_TEST(equals(edge.getNormal(), edgeNormals[edge.getID()].normalized()));
+    }
+    auto triangle = reference.triangles().begin();
+    for (const auto &meshTriangle : mesh.triangles()) {
+      BOOST_TEST(equals(meshTriangle.getNormal(), (triangle++)->getNormal()));
+    }
+  }
+  utils::ThreadPool::instance().setThreads(1);
+}
+
 BOOST_AUTO_TEST_CASE(ResizeDataGrow)
 {
   PRECICE_TEST(1_rank);
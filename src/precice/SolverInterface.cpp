@@ -42,6 +42,29 @@ double SolverInterface::advance(
   return _impl->advance(computedTimestepLength);
 }
 
+void SolverInterface::startAdvance(
+    double computedTimestepLength)
+{
+  _impl->startAdvance(computedTimestepLength);
+}
+
+double SolverInterface::finishAdvance()
+{
+  return _impl->finishAdvance();
+}
+
+void SolverInterface::writeRestartCheckpoint(
+    const std::string &directory)
+{
+  _impl->writeRestartCheckpoint(directory);
+}
+
+void SolverInterface::readRestartCheckpoint(
+    const std::string &directory)
+{
+  _impl->readRestartCheckpoint(directory);
+}
+
 void SolverInterface::finalize()
 {
   return _impl->finalize();
@@ -144,6 +144,78 @@ public:
    */
   double advance(double computedTimestepLength);
 
+  /**
+   * @brief Starts to advance preCICE, split-phase variant of advance().
+   *
+   * Maps the written data and sends all data, which does not depend on data received
+   * in this advance. The solver can then do work, which is independent of the coupling,
+   * e.g., assemble the next timestep, while the data is in transit. The advance is
+   * completed by finishAdvance(). Calling startAdvance() followed by finishAdvance()
+   * is equivalent to calling advance().
+   *
+   * Communication can be hidden by both participants of a serial coupling scheme and by the
+   * first participant of a parallel coupling scheme. In an explicit parallel coupling scheme,
+   * the second participant hides communication as well, unless the m2n enforces gather-scatter.
+   *
+   * @param[in] computedTimestepLength Length of timestep used by the solver.
+   *
+   * @pre The same preconditions as for advance() hold.
+   * @post Until finishAdvance() is called, reading or writing data, querying the coupling state
+   * (e.g. isCouplingOngoing(), isTimeWindowComplete(), isActionRequired()), advance() and
+   * finalize() raise an error.
+   *
+   * @see finishAdvance()
+   */
+  void startAdvance(double computedTimestepLength);
+
+  /**
+   * @brief Completes advancing preCICE started by startAdvance().
+   *
+   * Receives the coupling data, maps it, and updates the coupling state.
+   *
+   * @pre startAdvance() has been called.
+   *
+   * @post The same postconditions as for advance() hold.
+   *
+   * @return Maximum length of next timestep to be computed by solver.
+   */
+  double finishAdvance();
+
+  /**
+   * @brief Writes a restart checkpoint of the coupling state.
+   *
+   * Every rank writes its part of the coupling state to the binary file
+   * "<directory>/<participant>-<rank>.checkpoint". The state comprises the time,
+   * the coupling data and the state of the acceleration, e.g., the quasi-Newton
+   * history and its QR decomposition. A simulation restarted from the checkpoint
+   * with readRestartCheckpoint() does not need to rebuild the quasi-Newton history.
+   *
+   * The solver has to checkpoint its own state at the same time window.
+   *
+   * @param[in] directory Directory of the checkpoint files, created if it does not exist.
+   *
+   * @pre initialize() has been called successfully.
+   * @pre isTimeWindowComplete() returns true.
+   *
+   * @see readRestartCheckpoint()
+   */
+  void writeRestartCheckpoint(const std::string &directory);
+
+  /**
+   * @brief Restarts the coupling from a checkpoint written by writeRestartCheckpoint().
+   *
+   * The coupling state is restored in initialize(), which continues with the time
+   * window following the checkpoint. All coupled participants have to be restarted
+   * from the same time window, with the same configuration and number of ranks.
+   *
+   * @param[in] directory Directory of the checkpoint files.
+   *
+   * @pre initialize() has not been called.
+   *
+   * @see writeRestartCheckpoint()
+   */
+  void readRestartCheckpoint(const std::string &directory);
+
   /**
    * @brief Finalizes preCICE.
    *
@@ -196,6 +268,8 @@ public:
    *
    * Data is classified to be new, if it has been received while calling
    * initialize() and before calling advance(), or in the last call of advance().
+   * After a restart, the data restored from the checkpoint is new until the
+   * first call of advance().
    * This is always true, if a participant does not make use of subcycling, i.e.
    * choosing smaller timesteps than the limits returned in intitialize() and
    * advance().
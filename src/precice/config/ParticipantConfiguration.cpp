@@ -11,6 +11,7 @@
 #include "io/ExportContext.hpp"
 #include "io/ExportVTK.hpp"
 #include "io/ExportVTKXML.hpp"
+#include "io/ExportXDMF.hpp"
 #include "io/SharedPointer.hpp"
 #include "io/config/ExportConfiguration.hpp"
 #include "logging/LogMacros.hpp"
@@ -172,6 +173,31 @@ ParticipantConfiguration::ParticipantConfiguration(
   tagUseMesh.addAttribute(attrProvide);
   tag.addSubtag(tagUseMesh);
 
+  XMLTag tagThreads(*this, TAG_THREADS, XMLTag::OCCUR_NOT_OR_ONCE);
+  doc = "Amount of threads per rank, which are used to compute and perform the data mappings. ";
+  doc += "By default, mappings run in a single thread. ";
+  doc += "The attribute io sets the amount of threads progressing asynchronous socket communication.";
+  tagThreads.setDocumentation(doc);
+  auto attrThreads = makeXMLAttribute(ATTR_VALUE, 1)
+                         .setDocumentation("Amount of threads including the thread calling preCICE.");
+  tagThreads.addAttribute(attrThreads);
+  auto attrIOThreads = makeXMLAttribute(ATTR_IO_THREADS, 1)
+                           .setDocumentation("Amount of threads, which progress the asynchronous transfers "
+                                             "of all socket communications of a rank.");
+  tagThreads.addAttribute(attrIOThreads);
+  tag.addSubtag(tagThreads);
+
+  XMLTag tagAsyncExports(*this, TAG_ASYNC_EXPORTS, XMLTag::OCCUR_NOT_OR_ONCE);
+  doc = "Writes exports, watch points, and watch integrals on a background thread. ";
+  doc += "Exports communicating between ranks, such as <export:xdmf>, are still written synchronously. ";
+  doc += "Meshes and data are copied when an export is due, the files are written while the solver continues. ";
+  doc += "All pending exports are written in finalize(). By default, exports are written synchronously.";
+  tagAsyncExports.setDocumentation(doc);
+  auto attrQueueSize = makeXMLAttribute(ATTR_QUEUE_SIZE, 2)
+                           .setDocumentation("Maximal amount of pending exports. If the queue is full, preCICE waits for the oldest export.");
+  tagAsyncExports.addAttribute(attrQueueSize);
+  tag.addSubtag(tagAsyncExports);
+
   std::list<XMLTag>  masterTags;
   XMLTag::Occurrence masterOcc = XMLTag::OCCUR_NOT_OR_ONCE;
   {
@@ -311,6 +337,20 @@ void ParticipantConfiguration::xmlTagCallback(
     config.nameMesh    = tag.getStringAttributeValue(ATTR_MESH);
     config.isScalingOn = tag.getBooleanAttributeValue(ATTR_SCALE_WITH_CONN);
     _watchIntegralConfigs.push_back(config);
+  } else if (tag.getName() == TAG_THREADS) {
+    int threads = tag.getIntAttributeValue(ATTR_VALUE);
+    PRECICE_CHECK(threads >= 1, "Participant \"" << _participants.back()->getName() << "\" uses " << threads << " threads. "
+                                                  << "Please use a positive amount of threads in the <threads value=\"...\" /> tag.");
+    _participants.back()->setThreads(threads);
+    int ioThreads = tag.getIntAttributeValue(ATTR_IO_THREADS);
+    PRECICE_CHECK(ioThreads >= 1, "Participant \"" << _participants.back()->getName() << "\" uses " << ioThreads << " IO threads. "
+                                                    << "Please use a positive amount of threads in the <threads io=\"...\" /> tag.");
+    _participants.back()->setIOThreads(ioThreads);
+  } else if (tag.getName() == TAG_ASYNC_EXPORTS) {
+    int queueSize = tag.getIntAttributeValue(ATTR_QUEUE_SIZE);
+    PRECICE_CHECK(queueSize >= 1, "Participant \"" << _participants.back()->getName() << "\" uses an export queue of size " << queueSize << ". "
+                                                     << "Please use a positive size in the <asynchronous-exports queue-size=\"...\" /> tag.");
+    _participants.back()->setExportQueueSize(queueSize);
   } else if (tag.getNamespace() == TAG_MASTER) {
     com::CommunicationConfiguration comConfig;
     com::PtrCommunication           com = comConfig.createCommunication(tag);
@@ -544,10 +584,28 @@ void ParticipantConfiguration::finishParticipantConfiguration(
     io::PtrExport exporter;
     if (exportContext.type == VALUE_VTK) {
       if (context.size > 1) {
-        exporter = io::PtrExport(new io::ExportVTKXML(exportContext.plotNormals));
+        auto format = io::ExportVTKXML::Format::ASCII;
+        if (exportContext.format == "binary") {
+          format = io::ExportVTKXML::Format::Binary;
+        } else if (exportContext.format == "compressed") {
+          format = io::ExportVTKXML::Format::Compressed;
+        }
+        exporter = io::PtrExport(new io::ExportVTKXML(exportContext.plotNormals, format));
       } else {
+        PRECICE_CHECK(exportContext.format == "ascii",
+                      "Participant " << _participants.back()->getName() << " runs serially and defines an <export:vtk/> tag with "
+                                     << "format=\"" << exportContext.format << "\". Serial VTK exports are always written as text, "
+                                     << "please remove the format attribute or set it to \"ascii\".");
         exporter = io::PtrExport(new io::ExportVTK(exportContext.plotNormals));
       }
+    } else if (exportContext.type == VALUE_XDMF) {
+#ifdef PRECICE_NO_MPI
+      PRECICE_ERROR("Participant " << _participants.back()->getName() << " defines an <export:xdmf/> tag, which is only available "
+                                   << "if preCICE was compiled with MPI support enabled. Either switch to <export:vtk/> or "
+                                   << "recompile preCICE with \"PRECICE_MPICommunication=ON\".");
+#else
+      exporter = io::PtrExport(new io::ExportXDMF(exportContext.plotNormals));
+#endif
     } else {
       PRECICE_ERROR("Participant " << _participants.back()->getName()
                                    << " defines an <export/> tag of unknown type \"" << exportContext.type << "\".");
@@ -73,6 +73,8 @@ private:
   const std::string TAG_WATCH_INTEGRAL = "watch-integral";
   const std::string TAG_WATCH_POINT    = "watch-point";
   const std::string TAG_MASTER         = "master";
+  const std::string TAG_THREADS        = "threads";
+  const std::string TAG_ASYNC_EXPORTS  = "asynchronous-exports";
 
   const std::string ATTR_NAME               = "name";
   const std::string ATTR_SOURCE_DATA        = "source-data";
@@ -91,12 +93,16 @@ private:
   const std::string ATTR_NETWORK            = "network";
   const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
   const std::string ATTR_SCALE_WITH_CONN    = "scale-with-connectivity";
+  const std::string ATTR_VALUE              = "value";
+  const std::string ATTR_IO_THREADS         = "io";
+  const std::string ATTR_QUEUE_SIZE         = "queue-size";
 
   const std::string VALUE_FILTER_ON_SLAVES = "on-slaves";
   const std::string VALUE_FILTER_ON_MASTER = "on-master";
   const std::string VALUE_NO_FILTER        = "no-filter";
 
-  const std::string VALUE_VTK = "vtk";
+  const std::string VALUE_VTK  = "vtk";
+  const std::string VALUE_XDMF = "xdmf";
 
   int _dimensions = 0;
 
@@ -332,5 +332,38 @@ void Participant::setUseMaster(bool useMaster)
   _useMaster = useMaster;
 }
 
+int Participant::getThreads() const
+{
+  return _threads;
+}
+
+void Participant::setThreads(int threads)
+{
+  PRECICE_ASSERT(threads >= 1, threads);
+  _threads = threads;
+}
+
+int Participant::getIOThreads() const
+{
+  return _ioThreads;
+}
+
+void Participant::setIOThreads(int threads)
+{
+  PRECICE_ASSERT(threads >= 1, threads);
+  _ioThreads = threads;
+}
+
+int Participant::getExportQueueSize() const
+{
+  return _exportQueueSize;
+}
+
+void Participant::setExportQueueSize(int size)
+{
+  PRECICE_ASSERT(size >= 0, size);
+  _exportQueueSize = size;
+}
+
 } // namespace impl
 } // namespace precice
@@ -158,6 +158,21 @@ public:
 
   void setUseMaster(bool useMaster);
 
+  /// Returns the amount of threads used for mapping kernels.
+  int getThreads() const;
+
+  void setThreads(int threads);
+
+  /// Returns the amount of threads used for asynchronous socket communication.
+  int getIOThreads() const;
+
+  void setIOThreads(int threads);
+
+  /// Returns the maximal amount of pending asynchronous exports, 0 for synchronous exports.
+  int getExportQueueSize() const;
+
+  void setExportQueueSize(int size);
+
   void setMeshIdManager(std::unique_ptr<utils::ManageUniqueIDs> &&idm)
   {
     _meshIdManager = std::move(idm);
@@ -199,6 +214,12 @@ private:
 
   bool _useMaster = false;
 
+  int _threads = 1;
+
+  int _ioThreads = 1;
+
+  int _exportQueueSize = 0;
+
   std::unique_ptr<utils::ManageUniqueIDs> _meshIdManager;
 
   template <typename ELEMENT_T>
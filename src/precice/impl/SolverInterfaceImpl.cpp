@@ -2,7 +2,16 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <array>
+#include <boost/filesystem.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION < 106600
+#include <boost/function_output_iterator.hpp>
+#else
+#include <boost/iterator/function_output_iterator.hpp>
+#endif
+#include <cstdint>
 #include <deque>
+#include <fstream>
 #include <functional>
 #include <iterator>
 #include <math.h>
@@ -13,10 +22,12 @@
 #include "action/SharedPointer.hpp"
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
+#include "com/SocketIOService.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/config/CouplingSchemeConfiguration.hpp"
 #include "io/Export.hpp"
 #include "io/ExportContext.hpp"
+#include "io/ExportQueue.hpp"
 #include "io/SharedPointer.hpp"
 #include "logging/LogConfiguration.hpp"
 #include "logging/LogMacros.hpp"
@@ -53,6 +64,8 @@
 #include "precice/impl/WatchIntegral.hpp"
 #include "precice/impl/WatchPoint.hpp"
 #include "precice/impl/versions.hpp"
+#include "query/RTree.hpp"
+#include "utils/BinaryIO.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/EigenIO.hpp"
 #include "utils/Event.hpp"
@@ -62,6 +75,7 @@
 #include "utils/Parallel.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/PointerVector.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/assertion.hpp"
 #include "xml/XMLTag.hpp"
@@ -76,6 +90,84 @@ bool syncMode = false;
 
 namespace impl {
 
+namespace {
+/// Returns true, if the snapshot has the same vertex coordinates and connectivity as the mesh
+bool hasSameGeometry(mesh::Mesh &snapshot, mesh::Mesh &mesh)
+{
+  if (snapshot.vertices().size() != mesh.vertices().size() ||
+      snapshot.edges().size() != mesh.edges().size() ||
+      snapshot.triangles().size() != mesh.triangles().size()) {
+    return false;
+  }
+  for (size_t i = 0; i < mesh.vertices().size(); ++i) {
+    if (snapshot.vertices()[i].getCoords() != mesh.vertices()[i].getCoords()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < mesh.edges().size(); ++i) {
+    for (int j = 0; j < 2; ++j) {
+      if (snapshot.edges()[i].vertex(j).getID() != mesh.edges()[i].vertex(j).getID()) {
+        return false;
+      }
+    }
+  }
+  for (size_t i = 0; i < mesh.triangles().size(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      if (snapshot.triangles()[i].edge(j).getID() != mesh.triangles()[i].edge(j).getID()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Copies the geometry, vertex normals, vertex distribution and data of a mesh, such that it can be exported in the background
+ *
+ * Snapshots are reused once no pending export holds them anymore. The geometry is only copied, if it changed since
+ * the last use of the snapshot. The data of a snapshot is created once with the IDs of the original data.
+ */
+std::shared_ptr<mesh::Mesh> copyMeshForExport(mesh::Mesh &mesh, std::vector<std::shared_ptr<mesh::Mesh>> &snapshots)
+{
+  auto iter = std::find_if(snapshots.begin(), snapshots.end(), [](const std::shared_ptr<mesh::Mesh> &snapshot) {
+    return snapshot.use_count() == 1;
+  });
+  if (iter == snapshots.end()) {
+    std::shared_ptr<mesh::Mesh> snapshot(new mesh::Mesh(mesh.getName(), mesh.getDimensions(), mesh.isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED));
+    for (const mesh::PtrData &data : mesh.data()) {
+      snapshot->createData(data->getName(), data->getDimensions(), data->getID());
+    }
+    iter = snapshots.insert(snapshots.end(), std::move(snapshot));
+  }
+  mesh::Mesh &snapshot = **iter;
+  if (not hasSameGeometry(snapshot, mesh)) {
+    snapshot.clear();
+    snapshot.addMesh(mesh);
+  }
+  for (size_t i = 0; i < mesh.vertices().size(); ++i) {
+    snapshot.vertices()[i].setNormal(mesh.vertices()[i].getNormal());
+  }
+  snapshot.getVertexDistribution() = mesh.getVertexDistribution();
+  PRECICE_ASSERT(snapshot.data().size() == mesh.data().size());
+  for (size_t i = 0; i < mesh.data().size(); ++i) {
+    snapshot.data()[i]->values() = mesh.data()[i]->values();
+  }
+  return *iter;
+}
+
+/// Identifies restart checkpoint files
+constexpr char restartMagic[] = "preCICE-restart";
+
+/// Version of the restart checkpoint format
+constexpr std::int32_t restartVersion = 1;
+
+/// Returns the path of the restart checkpoint file of the given participant rank
+std::string restartCheckpointFile(const std::string &directory, const std::string &participant, int rank)
+{
+  return (boost::filesystem::path(directory) / (participant + "-" + std::to_string(rank) + ".checkpoint")).string();
+}
+} // namespace
+
 SolverInterfaceImpl::SolverInterfaceImpl(
     std::string        participantName,
     const std::string &configurationFileName,
@@ -159,6 +251,8 @@ void SolverInterfaceImpl::configure(
       _accessorName,
       _accessorProcessRank,
       _accessorCommunicatorSize};
+  // Parsing creates the data, whose IDs have to start at zero for every interface of this process.
+  mesh::Data::resetDataCount();
   xml::configure(config.getXMLTag(), context, configurationFileName);
   if (_accessorProcessRank == 0) {
     PRECICE_INFO("This is preCICE version " << PRECICE_VERSION);
@@ -197,6 +291,17 @@ void SolverInterfaceImpl::configure(
                 "you probably just want to remove the master tag from the preCICE configuration.");
 
   utils::MasterSlave::configure(_accessorProcessRank, _accessorCommunicatorSize);
+  utils::ThreadPool::instance().setThreads(_accessor->getThreads());
+  com::SocketIOService::instance().setThreads(_accessor->getIOThreads());
+  if (_accessor->getExportQueueSize() > 0) {
+    _exportQueue.reset(new io::ExportQueue(_accessor->getExportQueueSize()));
+    for (const PtrWatchPoint &watchPoint : _accessor->watchPoints()) {
+      watchPoint->setExportQueue(_exportQueue.get());
+    }
+    for (const PtrWatchIntegral &watchIntegral : _accessor->watchIntegrals()) {
+      watchIntegral->setExportQueue(_exportQueue.get());
+    }
+  }
 
   _participants = config.getParticipantConfiguration()->getParticipants();
   configureM2Ns(config.getM2NConfiguration());
@@ -308,7 +413,8 @@ double SolverInterfaceImpl::initialize()
 
   dt = _couplingScheme->getNextTimestepMaxLength();
 
-  if (_couplingScheme->hasDataBeenReceived()) {
+  // The read data of a restarted coupling has been restored, even if it was not received
+  if (_couplingScheme->hasDataBeenReceived() || _isRestarted) {
     performDataActions({action::Action::READ_MAPPING_PRIOR}, 0.0, 0.0, 0.0, dt);
     mapReadData();
     performDataActions({action::Action::READ_MAPPING_POST}, 0.0, 0.0, 0.0, dt);
@@ -351,7 +457,8 @@ void SolverInterfaceImpl::initializeData()
 
   _couplingScheme->initializeData();
 
-  if (_couplingScheme->hasDataBeenReceived()) {
+  // The read data of a restarted coupling has been restored, even if it was not received
+  if (_couplingScheme->hasDataBeenReceived() || _isRestarted) {
     performDataActions({action::Action::READ_MAPPING_PRIOR}, 0.0, 0.0, 0.0, dt);
     mapReadData();
     performDataActions({action::Action::READ_MAPPING_POST}, 0.0, 0.0, 0.0, dt);
@@ -385,6 +492,55 @@ double SolverInterfaceImpl::advance(
   Event                    e("advance", precice::syncMode);
   utils::ScopedEventPrefix sep("advance/");
 
+  PRECICE_CHECK(not _isAdvancing, "advance() cannot be called between startAdvance() and finishAdvance().");
+  beginAdvance(computedTimestepLength);
+  double maxTimestepLength = completeAdvance();
+
+  solverEvent.start(precice::syncMode);
+  return maxTimestepLength;
+}
+
+void SolverInterfaceImpl::startAdvance(
+    double computedTimestepLength)
+{
+  PRECICE_TRACE(computedTimestepLength);
+
+  auto &solverEvent = EventRegistry::instance().getStoredEvent("solver.advance");
+  solverEvent.stop(precice::syncMode);
+  auto &solverInitEvent = EventRegistry::instance().getStoredEvent("solver.initialize");
+  solverInitEvent.stop(precice::syncMode);
+
+  Event                    e("startAdvance", precice::syncMode);
+  utils::ScopedEventPrefix sep("startAdvance/");
+
+  PRECICE_CHECK(not _isAdvancing, "startAdvance() cannot be called again before finishAdvance().");
+  beginAdvance(computedTimestepLength);
+
+  // The solver works until it calls finishAdvance()
+  solverEvent.start(precice::syncMode);
+}
+
+double SolverInterfaceImpl::finishAdvance()
+{
+  PRECICE_TRACE();
+
+  auto &solverEvent = EventRegistry::instance().getStoredEvent("solver.advance");
+  solverEvent.stop(precice::syncMode);
+
+  Event                    e("finishAdvance", precice::syncMode);
+  utils::ScopedEventPrefix sep("finishAdvance/");
+
+  PRECICE_CHECK(_isAdvancing, "finishAdvance() can only be called after startAdvance().");
+  double maxTimestepLength = completeAdvance();
+
+  solverEvent.start(precice::syncMode);
+  return maxTimestepLength;
+}
+
+void SolverInterfaceImpl::beginAdvance(
+    double computedTimestepLength)
+{
+  PRECICE_TRACE(computedTimestepLength);
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before advance().");
   PRECICE_CHECK(_state != State::Finalized, "advance() cannot be called after finalize().")
   PRECICE_ASSERT(_couplingScheme->isInitialized());
@@ -402,38 +558,48 @@ double SolverInterfaceImpl::advance(
   }
 #endif
 
-  double timeWindowSize         = 0.0; // Length of (full) current time window
-  double timeWindowComputedPart = 0.0; // Length of computed part of (full) current time window
-  double time                   = 0.0; // Current time
-
   // Update the coupling scheme time state. Necessary to get correct remainder.
   _couplingScheme->addComputedTime(computedTimestepLength);
 
+  AdvanceTimes &times = _advanceTimes;
+  times.timestepLength = computedTimestepLength;
   if (_couplingScheme->hasTimeWindowSize()) {
-    timeWindowSize = _couplingScheme->getTimeWindowSize();
+    times.timeWindowSize = _couplingScheme->getTimeWindowSize();
   } else {
-    timeWindowSize = computedTimestepLength;
+    times.timeWindowSize = computedTimestepLength;
   }
-  timeWindowComputedPart = timeWindowSize - _couplingScheme->getThisTimeWindowRemainder();
-  time                   = _couplingScheme->getTime();
+  times.timeWindowComputedPart = times.timeWindowSize - _couplingScheme->getThisTimeWindowRemainder();
+  times.time                   = _couplingScheme->getTime();
 
   if (_couplingScheme->willDataBeExchanged(0.0)) {
-    performDataActions({action::Action::WRITE_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::WRITE_MAPPING_PRIOR}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
     mapWrittenData();
-    performDataActions({action::Action::WRITE_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::WRITE_MAPPING_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
   }
 
-  PRECICE_DEBUG("Advance coupling scheme");
-  _couplingScheme->advance();
+  PRECICE_DEBUG("Start advancing coupling scheme");
+  _couplingScheme->startAdvance();
+  _isAdvancing = true;
+}
+
+double SolverInterfaceImpl::completeAdvance()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(_isAdvancing);
+  const AdvanceTimes &times = _advanceTimes;
+
+  PRECICE_DEBUG("Finish advancing coupling scheme");
+  _couplingScheme->finishAdvance();
+  _isAdvancing = false;
 
   if (_couplingScheme->hasDataBeenReceived()) {
-    performDataActions({action::Action::READ_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::READ_MAPPING_PRIOR}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
     mapReadData();
-    performDataActions({action::Action::READ_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::READ_MAPPING_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
   }
 
   if (_couplingScheme->isTimeWindowComplete()) {
-    performDataActions({action::Action::ON_TIME_WINDOW_COMPLETE_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
+    performDataActions({action::Action::ON_TIME_WINDOW_COMPLETE_POST}, times.time, times.timestepLength, times.timeWindowComputedPart, times.timeWindowSize);
   }
 
   PRECICE_INFO(_couplingScheme->printCouplingState());
@@ -444,14 +610,70 @@ double SolverInterfaceImpl::advance(
   resetWrittenData();
 
   _meshLock.lockAll();
-  solverEvent.start(precice::syncMode);
   return _couplingScheme->getNextTimestepMaxLength();
 }
 
+void SolverInterfaceImpl::writeRestartCheckpoint(
+    const std::string &directory)
+{
+  PRECICE_TRACE(directory);
+  PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before writeRestartCheckpoint(...).");
+  PRECICE_CHECK(_state != State::Finalized, "writeRestartCheckpoint(...) cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "writeRestartCheckpoint(...) cannot be called between startAdvance() and finishAdvance().");
+  PRECICE_CHECK(_couplingScheme->isTimeWindowComplete(),
+                "writeRestartCheckpoint(...) can only be called at the end of a time window, i.e., if isTimeWindowComplete() returns true.");
+  Event e("writeRestartCheckpoint", precice::syncMode);
+
+  boost::system::error_code error;
+  boost::filesystem::create_directories(directory, error);
+  const std::string filename = restartCheckpointFile(directory, _accessorName, _accessorProcessRank);
+  std::ofstream     out(filename, std::ios::binary | std::ios::trunc);
+  PRECICE_CHECK(out, "Cannot open the restart checkpoint file \"" << filename << "\" for writing.");
+
+  out.write(restartMagic, sizeof(restartMagic));
+  utils::writeBinary(out, restartVersion);
+  utils::writeBinary(out, _accessorCommunicatorSize);
+  _couplingScheme->exportState(out);
+  out.close();
+  PRECICE_CHECK(out, "Writing the restart checkpoint file \"" << filename << "\" failed.");
+  PRECICE_DEBUG("Wrote restart checkpoint \"" << filename << "\"");
+}
+
+void SolverInterfaceImpl::readRestartCheckpoint(
+    const std::string &directory)
+{
+  PRECICE_TRACE(directory);
+  PRECICE_CHECK(_state == State::Constructed, "readRestartCheckpoint(...) has to be called before initialize().");
+  PRECICE_CHECK(not _isRestarted, "readRestartCheckpoint(...) may only be called once.");
+  Event e("readRestartCheckpoint", precice::syncMode);
+
+  const std::string filename = restartCheckpointFile(directory, _accessorName, _accessorProcessRank);
+  std::ifstream     in(filename, std::ios::binary);
+  PRECICE_CHECK(in, "Cannot open the restart checkpoint file \"" << filename << "\". "
+                                                                << "Make sure to restart with the same participants and number of ranks.");
+
+  char         magic[sizeof(restartMagic)] = {};
+  std::int32_t version                     = 0;
+  int          communicatorSize            = 0;
+  in.read(magic, sizeof(magic));
+  utils::readBinary(in, version);
+  utils::readBinary(in, communicatorSize);
+  PRECICE_CHECK(in && std::equal(std::begin(magic), std::end(magic), std::begin(restartMagic)) && version == restartVersion,
+                "The file \"" << filename << "\" is not a restart checkpoint of this preCICE version.");
+  PRECICE_CHECK(communicatorSize == _accessorCommunicatorSize,
+                "The restart checkpoint was written by " << communicatorSize << " ranks, but participant \""
+                                                         << _accessorName << "\" runs on " << _accessorCommunicatorSize << " ranks.");
+
+  _couplingScheme->importState(in);
+  _isRestarted = true;
+  PRECICE_DEBUG("Read restart checkpoint \"" << filename << "\"");
+}
+
 void SolverInterfaceImpl::finalize()
 {
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "finalize() may only be called once.")
+  PRECICE_CHECK(not _isAdvancing, "finalize() cannot be called between startAdvance() and finishAdvance().");
 
   // Events for the solver time, finally stopped here
   auto &solverEvent = EventRegistry::instance().getStoredEvent("solver.advance");
@@ -460,6 +682,8 @@ void SolverInterfaceImpl::finalize()
   Event                    e("finalize"); // no precice::syncMode here as MPI is already finalized at destruction of this event
   utils::ScopedEventPrefix sep("finalize/");
 
+  PRECICE_DEBUG("Spatial index cache: " << query::rtree::getStatistics());
+
   if (_state == State::Initialized) {
 
     PRECICE_ASSERT(_couplingScheme->isInitialized());
@@ -474,6 +698,11 @@ void SolverInterfaceImpl::finalize()
         exportMesh(suffix.str());
       }
     }
+    if (_exportQueue) {
+      PRECICE_DEBUG("Wait for asynchronous exports");
+      _exportQueue->flush();
+      _exportSnapshots.clear();
+    }
     // Apply some final ping-pong to synch solver that run e.g. with a uni-directional coupling only
     // afterwards close connections
     PRECICE_DEBUG("Synchronize participants and close communication channels");
@@ -539,6 +768,7 @@ bool SolverInterfaceImpl::isCouplingOngoing() const
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isCouplingOngoing() can be evaluated.");
   PRECICE_CHECK(_state != State::Finalized, "isCouplingOngoing() cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "isCouplingOngoing() cannot be called between startAdvance() and finishAdvance().");
   return _couplingScheme->isCouplingOngoing();
 }
 
@@ -547,7 +777,9 @@ bool SolverInterfaceImpl::isReadDataAvailable() const
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isReadDataAvailable().");
   PRECICE_CHECK(_state != State::Finalized, "isReadDataAvailable() cannot be called after finalize().");
-  return _couplingScheme->hasDataBeenReceived();
+  PRECICE_CHECK(not _isAdvancing, "isReadDataAvailable() cannot be called between startAdvance() and finishAdvance().");
+  // The read data restored from a restart checkpoint is available until the first advance
+  return _couplingScheme->hasDataBeenReceived() || (_isRestarted && _numberAdvanceCalls == 0);
 }
 
 bool SolverInterfaceImpl::isWriteDataRequired(
@@ -556,6 +788,7 @@ bool SolverInterfaceImpl::isWriteDataRequired(
   PRECICE_TRACE(computedTimestepLength);
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isWriteDataRequired().");
   PRECICE_CHECK(_state != State::Finalized, "isWriteDataRequired() cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "isWriteDataRequired() cannot be called between startAdvance() and finishAdvance().");
   return _couplingScheme->willDataBeExchanged(computedTimestepLength);
 }
 
@@ -564,6 +797,7 @@ bool SolverInterfaceImpl::isTimeWindowComplete() const
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isTimeWindowComplete().");
   PRECICE_CHECK(_state != State::Finalized, "isTimeWindowComplete() cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "isTimeWindowComplete() cannot be called between startAdvance() and finishAdvance().");
   return _couplingScheme->isTimeWindowComplete();
 }
 
@@ -573,6 +807,7 @@ bool SolverInterfaceImpl::isActionRequired(
   PRECICE_TRACE(action, _couplingScheme->isActionRequired(action));
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isActionRequired(...).");
   PRECICE_CHECK(_state != State::Finalized, "isActionRequired(...) cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "isActionRequired(...) cannot be called between startAdvance() and finishAdvance().");
   return _couplingScheme->isActionRequired(action);
 }
 
@@ -582,6 +817,7 @@ void SolverInterfaceImpl::markActionFulfilled(
   PRECICE_TRACE(action);
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before markActionFulfilled(...).");
   PRECICE_CHECK(_state != State::Finalized, "markActionFulfilled(...) cannot be called after finalize().");
+  PRECICE_CHECK(not _isAdvancing, "markActionFulfilled(...) cannot be called between startAdvance() and finishAdvance().");
   _couplingScheme->markActionFulfilled(action);
 }
 
@@ -706,8 +942,7 @@ void SolverInterfaceImpl::setMeshVertices(
   const Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
   for (int i = 0; i < size; ++i) {
-    Eigen::VectorXd current(posMatrix.col(i));
-    ids[i] = mesh->createVertex(current).getID();
+    ids[i] = mesh->createVertex(posMatrix.col(i)).getID();
   }
   mesh->allocateDataValues();
 }
@@ -749,13 +984,22 @@ void SolverInterfaceImpl::getMeshVertexIDsFromPositions(
   Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
   const auto vsize = vertices.size();
+  const auto index = query::rtree::getVertexRTree(mesh);
   for (size_t i = 0; i < size; i++) {
-    size_t j = 0;
-    for (; j < vsize; j++) {
-      if (math::equals(posMatrix.col(i), vertices[j].getCoords())) {
-        break;
-      }
-    }
+    const Eigen::VectorXd position = posMatrix.col(i);
+    // math::equals uses a relative tolerance, hence all candidates lie within this radius.
+    // The radius is doubled to be robust against rounding when computing the box corners.
+    const double radius = 2 * math::NUMERICAL_ZERO_DIFFERENCE * position.norm();
+    query::RTreeBox searchBox{(position.array() - radius).matrix(), (position.array() + radius).matrix()};
+
+    // Return the first matching vertex in case of duplicates to stay consistent with the linear search.
+    size_t j = vsize;
+    index->query(boost::geometry::index::intersects(searchBox),
+                 boost::make_function_output_iterator([&](size_t const &candidate) {
+                   if (candidate < j && math::equals(position, vertices[candidate].getCoords())) {
+                     j = candidate;
+                   }
+                 }));
     if (j == vsize) {
       std::ostringstream err;
       err << "Unable to find a vertex on mesh \"" << mesh->getName() << "\" at position (";
@@ -1295,15 +1539,30 @@ void SolverInterfaceImpl::exportMesh(
   PRECICE_TRACE(filenameSuffix, exportType);
   // Export meshes
   //const ExportContext& context = _accessor->exportContext();
+  std::map<int, std::shared_ptr<mesh::Mesh>> snapshots;
   for (const io::ExportContext &context : _accessor->exportContexts()) {
     PRECICE_DEBUG("Export type = " << exportType);
     bool exportAll  = exportType == io::constants::exportAll();
     bool exportThis = context.exporter->getType() == exportType;
     if (exportAll || exportThis) {
+      context.exporter->setTime(_couplingScheme->getTime());
       for (const MeshContext *meshContext : _accessor->usedMeshContexts()) {
         std::string name = meshContext->mesh->getName() + "-" + filenameSuffix;
         PRECICE_DEBUG("Exporting mesh to file \"" << name << "\" at location \"" << context.location << "\"");
-        context.exporter->doExport(name, context.location, *(meshContext->mesh));
+        if (_exportQueue && not context.exporter->isCollective()) {
+          // Exporters of the same call share the snapshot of a mesh
+          std::shared_ptr<mesh::Mesh> &snapshot = snapshots[meshContext->mesh->getID()];
+          if (not snapshot) {
+            snapshot = copyMeshForExport(*(meshContext->mesh), _exportSnapshots[meshContext->mesh->getID()]);
+          }
+          io::PtrExport               exporter = context.exporter;
+          std::string                 location = context.location;
+          _exportQueue->push([exporter, name, location, snapshot] {
+            exporter->doExport(name, location, *snapshot);
+          });
+        } else {
+          context.exporter->doExport(name, context.location, *(meshContext->mesh));
+        }
       }
     }
   }
@@ -1484,6 +1743,7 @@ void SolverInterfaceImpl::mapWrittenData()
   }
 
   // Map data
+  std::vector<impl::DataContext *> contextsToMap;
   for (impl::DataContext &context : _accessor->writeDataContexts()) {
     timing          = context.mappingContext.timing;
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
@@ -1491,16 +1751,14 @@ void SolverInterfaceImpl::mapWrittenData()
     rightTime |= timing == MappingConfiguration::INITIAL;
     bool hasMapped = context.mappingContext.hasMappedData;
     if (hasMapping && rightTime && (not hasMapped)) {
-      int inDataID  = context.fromData->getID();
-      int outDataID = context.toData->getID();
       PRECICE_DEBUG("Map data \"" << context.fromData->getName()
                                   << "\" from mesh \"" << context.mesh->getName() << "\"");
       context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      PRECICE_DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+      PRECICE_DEBUG("Map from dataID " << context.fromData->getID() << " to dataID: " << context.toData->getID());
+      contextsToMap.push_back(&context);
     }
   }
+  mapDataContexts(contextsToMap);
 
   // Clear non-stationary, non-incremental mappings
   for (impl::MappingContext &context : _accessor->writeMappingContexts()) {
@@ -1534,6 +1792,7 @@ void SolverInterfaceImpl::mapReadData()
   }
 
   // Map data
+  std::vector<impl::DataContext *> contextsToMap;
   for (impl::DataContext &context : _accessor->readDataContexts()) {
     timing      = context.mappingContext.timing;
     bool mapNow = timing == mapping::MappingConfiguration::ON_ADVANCE;
@@ -1541,15 +1800,13 @@ void SolverInterfaceImpl::mapReadData()
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
     bool hasMapped  = context.mappingContext.hasMappedData;
     if (mapNow && hasMapping && (not hasMapped)) {
-      int inDataID             = context.fromData->getID();
-      int outDataID            = context.toData->getID();
       context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
       PRECICE_DEBUG("Map read data \"" << context.fromData->getName()
                                        << "\" to mesh \"" << context.mesh->getName() << "\"");
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+      contextsToMap.push_back(&context);
     }
   }
+  mapDataContexts(contextsToMap);
   // Clear non-initial, non-incremental mappings
   for (impl::MappingContext &context : _accessor->readMappingContexts()) {
     bool isStationary = context.timing == mapping::MappingConfiguration::INITIAL;
@@ -1560,6 +1817,36 @@ void SolverInterfaceImpl::mapReadData()
   }
 }
 
+void SolverInterfaceImpl::mapDataContexts(const std::vector<DataContext *> &contexts)
+{
+  PRECICE_TRACE(contexts.size());
+  std::vector<mapping::PtrMapping> mappings;
+  std::vector<std::vector<int>>    inDataIDs;
+  std::vector<std::vector<int>>    outDataIDs;
+  for (DataContext *context : contexts) {
+    const auto &mapping = context->mappingContext.mapping;
+    auto        pos     = std::find(mappings.begin(), mappings.end(), mapping);
+    if (pos == mappings.end()) {
+      mappings.push_back(mapping);
+      inDataIDs.emplace_back();
+      outDataIDs.emplace_back();
+      pos = std::prev(mappings.end());
+    }
+    const auto index = std::distance(mappings.begin(), pos);
+    inDataIDs[index].push_back(context->fromData->getID());
+    outDataIDs[index].push_back(context->toData->getID());
+  }
+
+  for (size_t i = 0; i < mappings.size(); ++i) {
+    PRECICE_DEBUG("Map " << inDataIDs[i].size() << " data fields in one batch");
+    mappings[i]->mapBatch(inDataIDs[i], outDataIDs[i]);
+  }
+
+  for (const DataContext *context : contexts) {
+    PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context->toData->values()));
+  }
+}
+
 void SolverInterfaceImpl::performDataActions(
     const std::set<action::Action::Timing> &timings,
     double                                  time,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <set>
 #include <stddef.h>
 #include <string>
@@ -36,6 +37,9 @@ namespace precice {
 namespace cplscheme {
 class CouplingSchemeConfiguration;
 } // namespace cplscheme
+namespace io {
+class ExportQueue;
+} // namespace io
 namespace mesh {
 class Mesh;
 } // namespace mesh
@@ -140,6 +144,38 @@ public:
    */
   double advance(double computedTimestepLength);
 
+  /**
+   * @brief Starts advance(), maps and sends coupling data written by the solver.
+   *
+   * Sends all data, which does not depend on data received in this advance.
+   *
+   * @param[in] computedTimestepLength Length of timestep computed by solver.
+   */
+  void startAdvance(double computedTimestepLength);
+
+  /**
+   * @brief Completes advance() started by startAdvance().
+   *
+   * @return Maximum length of next timestep to be computed by solver.
+   */
+  double finishAdvance();
+
+  /**
+   * @brief Writes the coupling state of this rank to a restart checkpoint file.
+   *
+   * @param[in] directory Directory of the checkpoint files, created if it does not exist.
+   */
+  void writeRestartCheckpoint(const std::string &directory);
+
+  /**
+   * @brief Reads the coupling state of this rank from a restart checkpoint file.
+   *
+   * The state is applied to the coupling scheme in initialize().
+   *
+   * @param[in] directory Directory of the checkpoint files.
+   */
+  void readRestartCheckpoint(const std::string &directory);
+
   /**
    * @brief Finalizes the coupled simulation.
    *
@@ -483,7 +519,8 @@ public:
    * @brief Writes a mesh to vtk file.
    *
    * The plotting path has to be specified in the configuration of the
-   * accessing participant.
+   * accessing participant. Using asynchronous exports, a copy of the mesh
+   * is written by the export queue.
    *
    * @param[in] filenameSuffix Suffix of all plotted files
    */
@@ -532,6 +569,12 @@ private:
 
   impl::PtrParticipant _accessor;
 
+  /// Writes exports in the background, nullptr for synchronous exports.
+  std::unique_ptr<io::ExportQueue> _exportQueue;
+
+  /// Snapshots of the meshes per mesh ID for asynchronous exports, reused once their exports are finished.
+  mutable std::map<int, std::vector<std::shared_ptr<mesh::Mesh>>> _exportSnapshots;
+
   /// Spatial dimensions of problem.
   int _dimensions = 0;
 
@@ -566,6 +609,28 @@ private:
   /// Counts calls to advance for plotting.
   long int _numberAdvanceCalls = 0;
 
+  /// True between startAdvance() and finishAdvance().
+  bool _isAdvancing = false;
+
+  /// True, if the coupling state has been read from a restart checkpoint.
+  bool _isRestarted = false;
+
+  /// Time state of the current advance, which is passed to the data actions.
+  struct AdvanceTimes {
+    double time                   = 0.0;
+    double timestepLength         = 0.0;
+    double timeWindowComputedPart = 0.0;
+    double timeWindowSize         = 0.0;
+  };
+
+  AdvanceTimes _advanceTimes;
+
+  /// First part of advance(), which maps the written data and starts the coupling scheme advance.
+  void beginAdvance(double computedTimestepLength);
+
+  /// Second part of advance(), which completes the coupling scheme advance and maps the read data.
+  double completeAdvance();
+
   /**
    * @brief Configures the coupling interface from the given xml file.
    *
@@ -634,6 +699,14 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /**
+   * @brief Maps the data of the given contexts.
+   *
+   * Data sharing the same mapping is mapped in one batch, such that the mapping can
+   * process all data at once. The order of the batches is the order of first appearance.
+   */
+  void mapDataContexts(const std::vector<DataContext *> &contexts);
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -92,6 +92,7 @@
  */
 #define PRECICE_REQUIRE_DATA_READ_IMPL(id)                                                                                                                        \
   PRECICE_VALIDATE_DATA_ID_IMPL(id)                                                                                                                               \
+  PRECICE_CHECK(not _isAdvancing, "Data cannot be read between startAdvance() and finishAdvance().");                                                             \
   DataContext &context = _accessor->dataContext(id);                                                                                                              \
   PRECICE_CHECK((_accessor->isDataUsed(id) && _accessor->isDataRead(id)),                                                                                         \
                 "This participant does not use Data \"" << context.getName() << "\", but attempted to read it. Please extend the configuarion of partiticpant \"" \
@@ -103,6 +104,7 @@
  */
 #define PRECICE_REQUIRE_DATA_WRITE_IMPL(id)                                                                                                                        \
   PRECICE_VALIDATE_DATA_ID_IMPL(id)                                                                                                                                \
+  PRECICE_CHECK(not _isAdvancing, "Data cannot be written between startAdvance() and finishAdvance().");                                                           \
   DataContext &context = _accessor->dataContext(id);                                                                                                               \
   PRECICE_CHECK((_accessor->isDataUsed(id) && _accessor->isDataWrite(id)),                                                                                         \
                 "This participant does not use Data \"" << context.getName() << "\", but attempted to write it. Please extend the configuarion of partiticpant \"" \
@@ -117,6 +117,11 @@ void WatchIntegral::exportIntegralData(
   }
 }
 
+void WatchIntegral::setExportQueue(io::ExportQueue *queue)
+{
+  _txtWriter.setExportQueue(queue);
+}
+
 Eigen::VectorXd WatchIntegral::calculateVectorData(mesh::PtrData data)
 {
 
@@ -41,6 +41,9 @@ public:
   /// Writes one line with data of the integral over the mesh into the output file.
   void exportIntegralData(double time);
 
+  /// Writes the lines on the background thread of the given queue.
+  void setExportQueue(io::ExportQueue *queue);
+
   /// Adds surface area information based on mesh connectivity
   void initialize();
 
@@ -169,6 +169,11 @@ void WatchPoint::exportPointData(
   }
 }
 
+void WatchPoint::setExportQueue(io::ExportQueue *queue)
+{
+  _txtWriter.setExportQueue(queue);
+}
+
 void WatchPoint::getValue(
     Eigen::VectorXd &value,
     mesh::PtrData &  data)
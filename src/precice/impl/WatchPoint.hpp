@@ -44,6 +44,9 @@ public:
   /// Writes one line with data of the watchpoint into the output file.
   void exportPointData(double time);
 
+  /// Writes the lines on the background thread of the given queue.
+  void setExportQueue(io::ExportQueue *queue);
+
 private:
   logging::Logger _log{"impl::WatchPoint"};
 
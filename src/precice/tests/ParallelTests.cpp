@@ -1,6 +1,8 @@
 #ifndef PRECICE_NO_MPI
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstring>
 #include <memory>
 #include <mpi.h>
 #include <string>
@@ -175,11 +177,8 @@ BOOST_AUTO_TEST_CASE(ConstructAndExplicitFinalize)
 
 BOOST_AUTO_TEST_SUITE_END()
 
-BOOST_AUTO_TEST_CASE(GlobalRBFPartitioning)
+void runTestGlobalRBFPartitioning(const std::string &configFilename, const TestContext &context)
 {
-  PRECICE_TEST("SolverOne"_on(3_ranks), "SolverTwo"_on(1_rank));
-  std::string configFilename = _pathToTests + "globalRBFPartitioning.xml";
-
   if (context.isNamed("SolverOne")) {
     SolverInterface interface(context.name, configFilename, context.rank, context.size);
     int             meshID = interface.getMeshID("MeshOne");
@@ -211,6 +210,19 @@ BOOST_AUTO_TEST_CASE(GlobalRBFPartitioning)
   }
 }
 
+BOOST_AUTO_TEST_CASE(GlobalRBFPartitioning)
+{
+  PRECICE_TEST("SolverOne"_on(3_ranks), "SolverTwo"_on(1_rank));
+  runTestGlobalRBFPartitioning(_pathToTests + "globalRBFPartitioning.xml", context);
+}
+
+/// Same as GlobalRBFPartitioning, using two threads for the mappings
+BOOST_AUTO_TEST_CASE(GlobalRBFPartitioningThreads)
+{
+  PRECICE_TEST("SolverOne"_on(3_ranks), "SolverTwo"_on(1_rank));
+  runTestGlobalRBFPartitioning(_pathToTests + "globalRBFPartitioning-threads.xml", context);
+}
+
 BOOST_AUTO_TEST_CASE(LocalRBFPartitioning)
 {
   PRECICE_TEST("SolverOne"_on(3_ranks), "SolverTwo"_on(1_rank));
@@ -545,6 +557,174 @@ BOOST_AUTO_TEST_CASE(TestQN3EmptyPartition)
   runTestQNEmptyPartition(config, context);
 }
 
+BOOST_AUTO_TEST_CASE(TestQN4)
+{
+  PRECICE_TEST("SolverOne"_on(2_ranks), "SolverTwo"_on(2_ranks));
+  // parallel coupling, IQN-ILS, strict QR2 filter, CGS2 orthogonalization
+  std::string config = _pathToTests + "QN4.xml";
+  runTestQN(config, context);
+}
+
+BOOST_AUTO_TEST_CASE(TestQN4EmptyPartition)
+{
+  PRECICE_TEST("SolverOne"_on(2_ranks), "SolverTwo"_on(2_ranks));
+  // parallel coupling, IQN-ILS, strict QR2 filter, CGS2 orthogonalization
+  std::string config = _pathToTests + "QN4.xml";
+  runTestQNEmptyPartition(config, context);
+}
+
+/**
+ * Runs a time dependent variant of the problem of runTestQN for all time windows, and writes a restart
+ * checkpoint to checkpointDirectory after the second time window. If restart is true, the coupling is
+ * restarted from this checkpoint instead. Returns the iterations of all computed time windows.
+ */
+std::vector<int> runTestQNTimeWindows(std::string const &config, TestContext const &context, std::string const &checkpointDirectory, bool restart, double *outValues)
+{
+  std::string meshName, writeDataName, readDataName;
+
+  if (context.isNamed("SolverOne")) {
+    meshName      = "MeshOne";
+    writeDataName = "Data1";
+    readDataName  = "Data2";
+  } else {
+    BOOST_REQUIRE(context.isNamed("SolverTwo"));
+    meshName      = "MeshTwo";
+    writeDataName = "Data2";
+    readDataName  = "Data1";
+  }
+
+  SolverInterface interface(context.name, config, context.rank, context.size);
+  int             meshID      = interface.getMeshID(meshName);
+  int             writeDataID = interface.getDataID(writeDataName, meshID);
+  int             readDataID  = interface.getDataID(readDataName, meshID);
+
+  int vertexIDs[4];
+
+  // meshes for rank 0 and rank 1, we use matching meshes for both participants
+  double positions0[8] = {1.0, 0.0, 1.0, 0.5, 1.0, 1.0, 1.0, 1.5};
+  double positions1[8] = {2.0, 0.0, 2.0, 0.5, 2.0, 1.0, 2.0, 1.5};
+
+  if (context.isMaster()) {
+    interface.setMeshVertices(meshID, 4, positions0, vertexIDs);
+  } else {
+    interface.setMeshVertices(meshID, 4, positions1, vertexIDs);
+  }
+
+  if (restart) {
+    interface.readRestartCheckpoint(checkpointDirectory);
+  }
+  interface.initialize();
+  double inValues[4] = {0.0, 0.0, 0.0, 0.0};
+
+  std::vector<int> iterations;
+  int              timeWindow       = restart ? 3 : 1;
+  int              windowIterations = 0;
+
+  while (interface.isCouplingOngoing()) {
+    if (interface.isActionRequired(precice::constants::actionWriteIterationCheckpoint())) {
+      interface.markActionFulfilled(precice::constants::actionWriteIterationCheckpoint());
+    }
+
+    if (interface.isReadDataAvailable())
+      interface.readBlockScalarData(readDataID, 4, vertexIDs, inValues);
+
+    // Same equations as in runTestQN with 4 replaced by c, the roots are (+/-sqrt(c), 0, +/-sqrt(c), +/-sqrt(c)).
+    const double c = 4.0 + 0.5 * (timeWindow - 1);
+    if (context.isNamed("SolverOne")) {
+      for (int i = 0; i < 4; i++) {
+        outValues[i] = inValues[i]; //only pushes solution through
+      }
+    } else {
+      outValues[0] = 2 * inValues[0] * inValues[0] - inValues[1] * inValues[2] - 2.0 * c + inValues[0];
+      outValues[1] = inValues[0] * inValues[0] * inValues[1] + 2.0 * inValues[0] * inValues[1] * inValues[2] + inValues[1] * inValues[2] * inValues[2] + inValues[1];
+      outValues[2] = inValues[2] * inValues[2] - c + inValues[2];
+      outValues[3] = inValues[3] * inValues[3] - c + inValues[3];
+    }
+
+    interface.writeBlockScalarData(writeDataID, 4, vertexIDs, outValues);
+    interface.advance(1.0);
+
+    if (interface.isActionRequired(precice::constants::actionReadIterationCheckpoint())) {
+      interface.markActionFulfilled(precice::constants::actionReadIterationCheckpoint());
+    }
+    windowIterations++;
+
+    if (interface.isTimeWindowComplete()) {
+      iterations.push_back(windowIterations);
+      windowIterations = 0;
+      if (not restart && timeWindow == 2) {
+        interface.writeRestartCheckpoint(checkpointDirectory);
+      }
+      timeWindow++;
+    }
+  }
+
+  interface.finalize();
+  return iterations;
+}
+
+/// tests that a restarted coupling continues with the same quasi-Newton state as the uninterrupted coupling
+void runTestQNRestart(std::string const &config, TestContext const &context)
+{
+  double referenceValues[4];
+  double restartValues[4];
+
+  // All ranks of both participants share a new temporary checkpoint directory.
+  MPI_Comm testComm;
+  MPI_Comm_dup(utils::Parallel::getGlobalCommState()->comm, &testComm);
+  int testRank = 0;
+  MPI_Comm_rank(testComm, &testRank);
+  char directoryBuffer[1024] = {};
+  if (testRank == 0) {
+    const auto directory = boost::filesystem::unique_path(boost::filesystem::temp_directory_path() / "precice-restart-%%%%-%%%%-%%%%");
+    std::strncpy(directoryBuffer, directory.string().c_str(), sizeof(directoryBuffer) - 1);
+  }
+  MPI_Bcast(directoryBuffer, sizeof(directoryBuffer), MPI_CHAR, 0, testComm);
+  const std::string checkpointDirectory(directoryBuffer);
+
+  std::vector<int> reference = runTestQNTimeWindows(config, context, checkpointDirectory, false, referenceValues);
+  // finalize() resets the communicators, hence split them again for the second run.
+  utils::Parallel::restrictCommunicator(context.size * 2);
+  utils::Parallel::splitCommunicator(context.name);
+  std::vector<int> restarted = runTestQNTimeWindows(config, context, checkpointDirectory, true, restartValues);
+
+  MPI_Barrier(testComm);
+  if (testRank == 0) {
+    boost::filesystem::remove_all(checkpointDirectory);
+  }
+  MPI_Comm_free(&testComm);
+
+  BOOST_TEST_REQUIRE(reference.size() == 4);
+  BOOST_TEST_REQUIRE(restarted.size() == 2);
+  BOOST_TEST(restarted[0] == reference[2]);
+  BOOST_TEST(restarted[1] == reference[3]);
+  for (int i = 0; i < 4; i++) {
+    BOOST_TEST(restartValues[i] == referenceValues[i], boost::test_tools::tolerance(1e-12));
+  }
+
+  // relative residual in config is 1e-7, so 2 orders of magnitude less strict
+  BOOST_TEST(restartValues[0] == -std::sqrt(5.5), boost::test_tools::tolerance(1e-5));
+  BOOST_TEST(restartValues[1] == 0.0, boost::test_tools::tolerance(1e-5));
+  BOOST_TEST(restartValues[2] == -std::sqrt(5.5), boost::test_tools::tolerance(1e-5));
+  BOOST_TEST(restartValues[3] == -std::sqrt(5.5), boost::test_tools::tolerance(1e-5));
+}
+
+BOOST_AUTO_TEST_CASE(TestQNRestart)
+{
+  PRECICE_TEST("SolverOne"_on(2_ranks), "SolverTwo"_on(2_ranks));
+  // serial coupling, IQN-ILS reusing two time windows, residual-sum preconditioner
+  std::string config = _pathToTests + "QN5.xml";
+  runTestQNRestart(config, context);
+}
+
+BOOST_AUTO_TEST_CASE(TestIMVJRestart)
+{
+  PRECICE_TEST("SolverOne"_on(2_ranks), "SolverTwo"_on(2_ranks));
+  // serial coupling, IQN-IMVJ without restart mode, residual-sum preconditioner
+  std::string config = _pathToTests + "QN6.xml";
+  runTestQNRestart(config, context);
+}
+
 /// Tests various distributed communication schemes.
 void runTestDistributedCommunication(std::string const &config, TestContext const &context)
 {
@@ -284,15 +284,28 @@ BOOST_AUTO_TEST_CASE(testExplicitWithSubcycling)
   }
 }
 
-/// One solver uses incremental position set, read/write methods.
-BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
+/**
+ * @brief One solver uses incremental position set, read/write methods.
+ *
+ * @param[in] configurationFileName Configuration of a serial explicit coupling scheme.
+ * @param[in] splitAdvance Advances using startAdvance() and finishAdvance() instead of advance().
+ */
+void runTestExplicitWithDataExchange(std::string const &configurationFileName, bool splitAdvance, TestContext const &context)
 {
-  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
-
   double counter = 0.0;
   using Eigen::Vector3d;
 
-  SolverInterface cplInterface(context.name, _pathToTests + "explicit-mpi-single.xml", 0, 1);
+  SolverInterface cplInterface(context.name, configurationFileName, 0, 1);
+
+  auto advance = [&cplInterface, splitAdvance](double dt) {
+    if (not splitAdvance) {
+      return cplInterface.advance(dt);
+    }
+    cplInterface.startAdvance(dt);
+    // The solver would do work here, which does not depend on the coupling
+    return cplInterface.finishAdvance();
+  };
+
   if (context.isNamed("SolverOne")) {
     int meshOneID = cplInterface.getMeshID("MeshOne");
     /* int squareID = */ cplInterface.getMeshID("Test-Square");
@@ -306,9 +319,9 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
     cplInterface.setMeshVertex(meshOneID, vertex.data());
     double maxDt = cplInterface.initialize();
 
-    const auto &vertices = impl(cplInterface).mesh("Test-Square").vertices();
+    const auto &vertices = testing::WhiteboxAccessor::impl(cplInterface).mesh("Test-Square").vertices();
     while (cplInterface.isCouplingOngoing()) {
-      impl(cplInterface).resetMesh(meshOneID);
+      testing::WhiteboxAccessor::impl(cplInterface).resetMesh(meshOneID);
 
       i = 0;
       for (auto &vertex : vertices) {
@@ -322,7 +335,7 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
         Vector3d force(Vector3d::Constant(counter) + vertex.getCoords());
         cplInterface.writeVectorData(forcesID, vertex.getID(), force.data());
       }
-      maxDt = cplInterface.advance(maxDt);
+      maxDt = advance(maxDt);
       if (cplInterface.isCouplingOngoing()) {
         i = 0;
         for (auto &vertex : vertices) {
@@ -346,7 +359,7 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
     int    forcesID     = cplInterface.getDataID("Forces", meshID);
     int    velocitiesID = cplInterface.getDataID("Velocities", meshID);
     double maxDt        = cplInterface.initialize();
-    auto & vertices     = impl(cplInterface).mesh("Test-Square").vertices();
+    auto & vertices     = testing::WhiteboxAccessor::impl(cplInterface).mesh("Test-Square").vertices();
     // SolverTwo does not start the coupled simulation and has, hence,
     // already received the first data to be validated.
     for (auto &vertex : vertices) {
@@ -361,7 +374,7 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
         Vector3d vel(Vector3d::Constant(counter - 1.0) + vertex.getCoords());
         cplInterface.writeVectorData(velocitiesID, vertex.getID(), vel.data());
       }
-      maxDt = cplInterface.advance(maxDt);
+      maxDt = advance(maxDt);
       if (cplInterface.isCouplingOngoing()) {
         for (auto &vertex : vertices) {
           Vector3d force = Vector3d::Zero();
@@ -375,6 +388,18 @@ BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
   }
 }
 
+BOOST_AUTO_TEST_CASE(testExplicitWithDataExchange)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  runTestExplicitWithDataExchange(_pathToTests + "explicit-mpi-single.xml", false, context);
+}
+
+BOOST_AUTO_TEST_CASE(testExplicitWithSplitAdvance)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  runTestExplicitWithDataExchange(_pathToTests + "explicit-mpi-single.xml", true, context);
+}
+
 /**
  * @brief The second solver initializes the data of the first.
  *
@@ -1457,6 +1482,18 @@ BOOST_AUTO_TEST_CASE(MappingNearestProjectionImplicitEdges)
   testMappingNearestProjection(defineEdgesExplicitly, configFile, context);
 }
 
+/**
+ * @brief Tests the Nearest Projection Mapping between two participants, where the reading participant uses two threads
+ *
+ */
+BOOST_AUTO_TEST_CASE(MappingNearestProjectionThreads)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  bool              defineEdgesExplicitly = true;
+  const std::string configFile            = _pathToTests + "mapping-nearest-projection-threads.xml";
+  testMappingNearestProjection(defineEdgesExplicitly, configFile, context);
+}
+
 /**
  * @brief Tests sending one mesh to multiple participants
  *
@@ -1803,6 +1840,13 @@ BOOST_AUTO_TEST_CASE(testWatchIntegralScaleAndNoScale)
   testWatchIntegral(configFile, context);
 }
 
+BOOST_AUTO_TEST_CASE(testWatchIntegralAsynchronous)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  const std::string configFile = _pathToTests + "watch-integral-async.xml";
+  testWatchIntegral(configFile, context);
+}
+
 void testQuadMappingNearestProjectionTallKite(bool defineEdgesExplicitly, const std::string configFile, const TestContext &context)
 {
   using Eigen::Vector3d;
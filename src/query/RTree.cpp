@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <boost/range/irange.hpp>
 #include <cstddef>
+#include <ostream>
 #include <utility>
 #include <vector>
 #include "mesh/Vertex.hpp"
@@ -12,8 +13,15 @@ namespace query {
 
 namespace bg = boost::geometry;
 
-// Initialize static member
+namespace {
+/// Cached trees are updated in place, if at most this fraction of their elements was appended to the mesh.
+/// Inserting elements one by one is about 10x slower per element than bulk loading all of them.
+constexpr double updateThreshold = 0.1;
+} // namespace
+
+// Initialize static members
 std::map<int, rtree::MeshIndices> precice::query::rtree::_cached_trees;
+rtree::Statistics                 precice::query::rtree::_statistics;
 
 rtree::MeshIndices &rtree::cacheEntry(int meshID)
 {
@@ -21,32 +29,70 @@ rtree::MeshIndices &rtree::cacheEntry(int meshID)
   return result.first->second;
 }
 
+template <typename TRAITS, typename INSERT>
+bool rtree::updateCachedTree(CachedTree<TRAITS> &cached, std::size_t size, INSERT insert)
+{
+  if (not cached.tree) {
+    return false;
+  }
+  const bool meshChanged = cached.meshChanged;
+  cached.meshChanged     = false;
+
+  const std::size_t indexed = cached.tree->size();
+  if (indexed == size) {
+    ++_statistics.hits;
+    if (meshChanged) {
+      ++_statistics.avoidedRebuilds;
+    }
+    return true;
+  }
+  // Meshes only grow by appending elements, so the indices of all indexed elements are still valid
+  if (indexed > size || (size - indexed) > updateThreshold * indexed) {
+    return false;
+  }
+  for (std::size_t i = indexed; i < size; ++i) {
+    insert(*cached.tree, i);
+  }
+  ++_statistics.updates;
+  ++_statistics.avoidedRebuilds;
+  return true;
+}
+
 rtree::vertex_traits::Ptr rtree::getVertexRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
   auto &cache = cacheEntry(mesh->getID());
-  if (cache.vertices) {
-    return cache.vertices;
+  // Creating vertices does not signal meshChanged, so a tree built before the
+  // mesh was completely defined (e.g. by vertex lookups through the API) is stale.
+  if (updateCachedTree(cache.vertices, mesh->vertices().size(),
+                       [](vertex_traits::RTree &tree, std::size_t i) { tree.insert(i); })) {
+    return cache.vertices.tree;
   }
 
+  auto tree           = createVertexRTree(*mesh);
+  cache.vertices.tree = tree;
+  ++_statistics.builds;
+  return tree;
+}
+
+rtree::vertex_traits::Ptr rtree::createVertexRTree(const mesh::Mesh &mesh)
+{
   // Generating the rtree is expensive, so passing everything in the ctor is
   // the best we can do. Even passing an index range instead of calling
   // tree->insert repeatedly is about 10x faster.
   impl::RTreeParameters      params;
-  vertex_traits::IndexGetter ind(mesh->vertices());
-  auto                       tree = std::make_shared<vertex_traits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->vertices().size()), params, ind);
-
-  cache.vertices = tree;
-  return tree;
+  vertex_traits::IndexGetter ind(mesh.vertices());
+  return std::make_shared<vertex_traits::RTree>(
+      boost::irange<std::size_t>(0lu, mesh.vertices().size()), params, ind);
 }
 
 rtree::edge_traits::Ptr rtree::getEdgeRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
   auto &cache = cacheEntry(mesh->getID());
-  if (cache.edges) {
-    return cache.edges;
+  if (updateCachedTree(cache.edges, mesh->edges().size(),
+                       [](edge_traits::RTree &tree, std::size_t i) { tree.insert(i); })) {
+    return cache.edges.tree;
   }
 
   // Generating the rtree is expensive, so passing everything in the ctor is
@@ -57,25 +103,30 @@ rtree::edge_traits::Ptr rtree::getEdgeRTree(const mesh::PtrMesh &mesh)
   auto                     tree = std::make_shared<edge_traits::RTree>(
       boost::irange<std::size_t>(0lu, mesh->edges().size()), params, ind);
 
-  cache.edges = tree;
+  cache.edges.tree = tree;
+  ++_statistics.builds;
   return tree;
 }
 
 rtree::triangle_traits::Ptr rtree::getTriangleRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
-  if (cache.triangles) {
-    return cache.triangles;
+  auto &cache     = cacheEntry(mesh->getID());
+  auto &triangles = mesh->triangles();
+  if (updateCachedTree(cache.triangles, triangles.size(),
+                       [&triangles](triangle_traits::RTree &tree, std::size_t i) {
+                         tree.insert(std::make_pair(bg::return_envelope<RTreeBox>(triangles[i]), i));
+                       })) {
+    return cache.triangles.tree;
   }
 
   // We first generate the values for the triangle rtree.
   // The resulting vector is a random access range, which can be passed to the
   // constructor of the rtree for more efficient indexing.
   std::vector<triangle_traits::IndexType> elements;
-  elements.reserve(mesh->triangles().size());
-  for (size_t i = 0; i < mesh->triangles().size(); ++i) {
-    auto box = bg::return_envelope<RTreeBox>(mesh->triangles()[i]);
+  elements.reserve(triangles.size());
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    auto box = bg::return_envelope<RTreeBox>(triangles[i]);
     elements.emplace_back(std::move(box), i);
   }
 
@@ -84,7 +135,8 @@ rtree::triangle_traits::Ptr rtree::getTriangleRTree(const mesh::PtrMesh &mesh)
   impl::RTreeParameters        params;
   triangle_traits::IndexGetter ind;
   auto                         tree = std::make_shared<triangle_traits::RTree>(elements, params, ind);
-  cache.triangles                   = tree;
+  cache.triangles.tree              = tree;
+  ++_statistics.builds;
   return tree;
 }
 
@@ -93,11 +145,65 @@ void rtree::clear(mesh::Mesh &mesh)
   _cached_trees.erase(mesh.getID());
 }
 
+void rtree::meshChanged(mesh::Mesh &mesh)
+{
+  auto entry = _cached_trees.find(mesh.getID());
+  if (entry == _cached_trees.end()) {
+    return;
+  }
+  auto &cache = entry->second;
+
+  // Trees can only be updated by inserting appended elements. Removed elements require a rebuild, as does
+  // a change without new elements, since the existing elements may have been modified.
+  const auto removed = [](const std::size_t indexed, const std::size_t size) { return indexed > size; };
+  const auto grown   = [](const std::size_t indexed, const std::size_t size) { return indexed < size; };
+
+  bool anyRemoved = false;
+  bool anyGrown   = false;
+  if (cache.vertices.tree) {
+    anyRemoved |= removed(cache.vertices.tree->size(), mesh.vertices().size());
+    anyGrown |= grown(cache.vertices.tree->size(), mesh.vertices().size());
+  }
+  if (cache.edges.tree) {
+    anyRemoved |= removed(cache.edges.tree->size(), mesh.edges().size());
+    anyGrown |= grown(cache.edges.tree->size(), mesh.edges().size());
+  }
+  if (cache.triangles.tree) {
+    anyRemoved |= removed(cache.triangles.tree->size(), mesh.triangles().size());
+    anyGrown |= grown(cache.triangles.tree->size(), mesh.triangles().size());
+  }
+  if (anyRemoved || not anyGrown) {
+    _cached_trees.erase(entry);
+    return;
+  }
+  cache.vertices.meshChanged  = true;
+  cache.edges.meshChanged     = true;
+  cache.triangles.meshChanged = true;
+}
+
 void rtree::clear()
 {
   _cached_trees.clear();
 }
 
+const rtree::Statistics &rtree::getStatistics()
+{
+  return _statistics;
+}
+
+void rtree::resetStatistics()
+{
+  _statistics = Statistics{};
+}
+
+std::ostream &operator<<(std::ostream &out, const rtree::Statistics &statistics)
+{
+  return out << statistics.builds << " builds, "
+             << statistics.updates << " in-place updates, "
+             << statistics.hits << " hits, "
+             << statistics.avoidedRebuilds << " avoided rebuilds";
+}
+
 Box3d getEnclosingBox(mesh::Vertex const &middlePoint, double sphereRadius)
 {
   namespace bg = boost::geometry;
@@ -2,6 +2,7 @@
 
 #include <Eigen/Core>
 #include <boost/geometry.hpp>
+#include <cstddef>
 #include <iosfwd>
 #include <map>
 #include <memory>
@@ -27,12 +28,27 @@ public:
   using edge_traits     = impl::RTreeTraits<mesh::Edge>;
   using triangle_traits = impl::RTreeTraits<mesh::Triangle>;
 
+  /// Amount of work done and saved by the cache, accumulated over all meshes
+  struct Statistics {
+    std::size_t builds          = 0; ///< Trees built from scratch
+    std::size_t updates         = 0; ///< Trees updated in place by inserting new elements
+    std::size_t hits            = 0; ///< Cached trees returned unchanged
+    std::size_t avoidedRebuilds = 0; ///< Trees reused or updated after a change of their mesh
+  };
+
   /// Returns the pointer to boost::geometry::rtree for the given mesh vertices
   /*
    * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * A cached tree is updated in place if few vertices were appended to the mesh since it was built.
    */
   static vertex_traits::Ptr getVertexRTree(const mesh::PtrMesh &mesh);
 
+  /// Creates a new boost::geometry::rtree for the given mesh vertices, which is not cached
+  /*
+   * Use this for temporary meshes without a valid ID, e.g. meshes gathered on the master.
+   */
+  static vertex_traits::Ptr createVertexRTree(const mesh::Mesh &mesh);
+
   static edge_traits::Ptr getEdgeRTree(const mesh::PtrMesh &mesh);
 
   static triangle_traits::Ptr getTriangleRTree(const mesh::PtrMesh &mesh);
@@ -40,26 +56,51 @@ public:
   /// Only clear the trees of that specific mesh
   static void clear(mesh::Mesh &mesh);
 
+  /// Handles a change of the mesh, trees are kept if elements were only appended and dropped otherwise
+  static void meshChanged(mesh::Mesh &mesh);
+
   /// Clear the complete cache
   static void clear();
 
+  static const Statistics &getStatistics();
+
+  static void resetStatistics();
+
   friend struct testing::accessors::rtree;
 
 private:
+  template <typename TRAITS>
+  struct CachedTree {
+    typename TRAITS::Ptr tree;
+    bool                 meshChanged = false; ///< The mesh changed since the tree was last requested
+  };
+
   struct MeshIndices {
-    vertex_traits::Ptr   vertices;
-    edge_traits::Ptr     edges;
-    triangle_traits::Ptr triangles;
+    CachedTree<vertex_traits>   vertices;
+    CachedTree<edge_traits>     edges;
+    CachedTree<triangle_traits> triangles;
   };
 
   static MeshIndices &cacheEntry(int MeshID);
 
+  /// Brings a cached tree up to date with a mesh of the given amount of elements
+  /*
+   * Inserts the missing elements using insert(tree, index), if only few elements were appended to the mesh.
+   * Returns false if the tree needs to be rebuilt.
+   */
+  template <typename TRAITS, typename INSERT>
+  static bool updateCachedTree(CachedTree<TRAITS> &cached, std::size_t size, INSERT insert);
+
   using RTreeCache = std::map<int, MeshIndices>;
-  static RTreeCache _cached_trees; ///< Cache for all index trees
+  static RTreeCache _cached_trees; ///< Cache for all index trees, not guarded as trees are only requested serially
+
+  static Statistics _statistics;
 };
 
 using Box3d = boost::geometry::model::box<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
 
+std::ostream &operator<<(std::ostream &out, const rtree::Statistics &statistics);
+
 /// Returns a boost::geometry box that encloses a sphere of given radius around a middle point
 Box3d getEnclosingBox(mesh::Vertex const &middlePoint, double sphereRadius);
 
@@ -60,6 +60,48 @@ struct access<Eigen::VectorXd, Dimension> {
 
 BOOST_CONCEPT_ASSERT((bg::concepts::Point<Eigen::VectorXd>) );
 
+/// Adapts Vertex::RawCoords to boost.geometry
+/*
+ * This adapts the coordinates of every Vertex to a 3d point. For non-existing dimensions, zero is returned.
+ */
+template <>
+struct tag<pm::Vertex::RawCoords> {
+  using type = point_tag;
+};
+template <>
+struct coordinate_type<pm::Vertex::RawCoords> {
+  using type = double;
+};
+template <>
+struct coordinate_system<pm::Vertex::RawCoords> {
+  using type = cs::cartesian;
+};
+template <>
+struct dimension<pm::Vertex::RawCoords> : boost::mpl::int_<3> {
+};
+
+template <size_t Dimension>
+struct access<pm::Vertex::RawCoords, Dimension> {
+  static double get(pm::Vertex::RawCoords const &p)
+  {
+    if (Dimension >= static_cast<size_t>(p.rows()))
+      return 0;
+
+    return p[Dimension];
+  }
+
+  static void set(pm::Vertex::RawCoords &p, double const &value)
+  {
+    // This handles default initialized RawCoords
+    if (p.size() == 0) {
+      p = pm::Vertex::RawCoords::Zero(3);
+    }
+    p[Dimension] = value;
+  }
+};
+
+BOOST_CONCEPT_ASSERT((bg::concepts::Point<pm::Vertex::RawCoords>) );
+
 /// Provides the necessary template specialisations to adapt precice's Vertex to boost.geometry
 /*
 * This adapts every Vertex to a 3d point. For non-existing dimensions, zero is returned.
@@ -92,7 +134,7 @@ struct access<pm::Vertex, Dimension> {
 
   static void set(pm::Vertex &p, double const &value)
   {
-    Eigen::VectorXd vec = p.getCoords();
+    pm::Vertex::RawCoords vec = p.getCoords();
     vec[Dimension]      = value;
     p.setCoords(vec);
   }
@@ -111,7 +153,7 @@ struct tag<pm::Edge> {
 };
 template <>
 struct point_type<pm::Edge> {
-  using type = Eigen::VectorXd;
+  using type = pm::Vertex::RawCoords;
 };
 
 template <size_t Index, size_t Dimension>
@@ -121,13 +163,13 @@ struct indexed_access<pm::Edge, Index, Dimension> {
 
   static double get(pm::Edge const &e)
   {
-    return access<Eigen::VectorXd, Dimension>::get(e.vertex(Index).getCoords());
+    return access<pm::Vertex::RawCoords, Dimension>::get(e.vertex(Index).getCoords());
   }
 
   static void set(pm::Edge &e, double const &value)
   {
-    Eigen::VectorXd v = e.vertex(Index).getCoords();
-    access<Eigen::VectorXd, Dimension>::set(v, value);
+    pm::Vertex::RawCoords v = e.vertex(Index).getCoords();
+    access<pm::Vertex::RawCoords, Dimension>::set(v, value);
     e.vertex(Index).setCoords(std::move(v));
   }
 };
@@ -431,6 +431,42 @@ BOOST_FIXTURE_TEST_CASE(ClearOnChange, precice::testing::accessors::rtree)
   BOOST_TEST(getCache().empty());
 }
 
+BOOST_FIXTURE_TEST_CASE(ClearOnRemoval, precice::testing::accessors::rtree)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector2d(0, 0));
+
+  // The Cache should clear whenever elements of a mesh are removed
+  auto vTree = query::rtree::getVertexRTree(mesh);
+  BOOST_TEST(getCache().size() == 1);
+  mesh->clear(); // Emits signal, that mesh has changed
+  BOOST_TEST(getCache().empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(KeepOnAppend, precice::testing::accessors::rtree)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
+  for (int i = 0; i < 20; ++i) {
+    mesh->createVertex(Eigen::Vector2d(i, 0));
+  }
+  precice::mesh::Mesh delta("Delta", 2, false, precice::testing::nextMeshID());
+  delta.createVertex(Eigen::Vector2d(0, 1));
+  query::rtree::resetStatistics();
+
+  // Appending elements keeps the cached trees and updates them in place
+  auto vt1 = query::rtree::getVertexRTree(mesh);
+  mesh->addMesh(delta); // Emits signal, that mesh has changed
+  BOOST_TEST(getCache().size() == 1);
+  auto vt2 = query::rtree::getVertexRTree(mesh);
+  BOOST_TEST(vt1 == vt2);
+  BOOST_TEST(vt2->size() == 21);
+  BOOST_TEST(query::rtree::getStatistics().builds == 1);
+  BOOST_TEST(query::rtree::getStatistics().updates == 1);
+  BOOST_TEST(query::rtree::getStatistics().avoidedRebuilds == 1);
+}
+
 BOOST_FIXTURE_TEST_CASE(ClearOnDestruction, precice::testing::accessors::rtree)
 {
   PRECICE_TEST(1_rank);
@@ -444,6 +480,69 @@ BOOST_FIXTURE_TEST_CASE(ClearOnDestruction, precice::testing::accessors::rtree)
   BOOST_TEST(getCache().empty());
 }
 
+BOOST_AUTO_TEST_CASE(RebuildOnAddedVertices)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector2d(0, 0));
+
+  // Creating vertices doesn't emit meshChanged, the tree still has to contain them
+  auto vt1 = rtree::getVertexRTree(mesh);
+  BOOST_TEST(vt1->size() == 1);
+  mesh->createVertex(Eigen::Vector2d(1, 0));
+  auto vt2 = rtree::getVertexRTree(mesh);
+  BOOST_TEST(vt2->size() == 2);
+  BOOST_TEST(vt1 != vt2);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateOnAddedVertices)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
+  for (int i = 0; i < 20; ++i) {
+    mesh->createVertex(Eigen::Vector2d(i, 0));
+  }
+  rtree::resetStatistics();
+
+  // Appending few vertices updates the cached tree in place
+  auto vt1 = rtree::getVertexRTree(mesh);
+  mesh->createVertex(Eigen::Vector2d(0, 1));
+  mesh->createVertex(Eigen::Vector2d(5, 1));
+  auto vt2 = rtree::getVertexRTree(mesh);
+  BOOST_TEST(vt1 == vt2);
+  BOOST_TEST(vt2->size() == 22);
+  BOOST_TEST(rtree::getStatistics().builds == 1);
+  BOOST_TEST(rtree::getStatistics().updates == 1);
+
+  Eigen::VectorXd     searchVector(Eigen::Vector2d(5, 2));
+  std::vector<size_t> results;
+  vt2->query(bgi::nearest(searchVector, 1), std::back_inserter(results));
+  BOOST_TEST(results.size() == 1);
+  BOOST_TEST(results.front() == 21);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateOnAddedTriangles)
+{
+  PRECICE_TEST(1_rank);
+  auto ptr = fullMesh();
+  rtree::resetStatistics();
+
+  // The mesh has two triangles, so appending one exceeds the update threshold
+  auto  tt1 = rtree::getTriangleRTree(ptr);
+  auto &v1  = ptr->createVertex(Eigen::Vector3d(0, 0, 5));
+  auto &v2  = ptr->createVertex(Eigen::Vector3d(1, 0, 5));
+  auto &v3  = ptr->createVertex(Eigen::Vector3d(0, 1, 5));
+  auto &e1  = ptr->createEdge(v1, v2);
+  auto &e2  = ptr->createEdge(v2, v3);
+  auto &e3  = ptr->createEdge(v3, v1);
+  ptr->createTriangle(e1, e2, e3);
+  auto tt2 = rtree::getTriangleRTree(ptr);
+  BOOST_TEST(tt1 != tt2);
+  BOOST_TEST(tt2->size() == 3);
+  BOOST_TEST(rtree::getStatistics().builds == 2);
+  BOOST_TEST(rtree::getStatistics().updates == 0);
+}
+
 BOOST_AUTO_TEST_CASE(CacheVertices)
 {
   PRECICE_TEST(1_rank);
@@ -63,6 +63,8 @@ target_sources(precice
     src/com/CommunicationFactory.hpp
     src/com/ConnectionInfoPublisher.cpp
     src/com/ConnectionInfoPublisher.hpp
+    src/com/DataCompressor.cpp
+    src/com/DataCompressor.hpp
     src/com/MPICommunication.cpp
     src/com/MPICommunication.hpp
     src/com/MPIDirectCommunication.cpp
@@ -79,11 +81,19 @@ target_sources(precice
     src/com/MPISinglePortsCommunicationFactory.hpp
     src/com/Request.cpp
     src/com/Request.hpp
+    src/com/SharedMemoryCommunication.cpp
+    src/com/SharedMemoryCommunication.hpp
+    src/com/SharedMemoryCommunicationFactory.cpp
+    src/com/SharedMemoryCommunicationFactory.hpp
     src/com/SharedPointer.hpp
     src/com/SocketCommunication.cpp
     src/com/SocketCommunication.hpp
     src/com/SocketCommunicationFactory.cpp
     src/com/SocketCommunicationFactory.hpp
+    src/com/SocketIOService.cpp
+    src/com/SocketIOService.hpp
+    src/com/SocketReceiveQueue.cpp
+    src/com/SocketReceiveQueue.hpp
     src/com/SocketRequest.cpp
     src/com/SocketRequest.hpp
     src/com/SocketSendQueue.cpp
@@ -124,10 +134,14 @@ target_sources(precice
     src/io/Constants.hpp
     src/io/Export.hpp
     src/io/ExportContext.hpp
+    src/io/ExportQueue.cpp
+    src/io/ExportQueue.hpp
     src/io/ExportVTK.cpp
     src/io/ExportVTK.hpp
     src/io/ExportVTKXML.cpp
     src/io/ExportVTKXML.hpp
+    src/io/ExportXDMF.cpp
+    src/io/ExportXDMF.hpp
     src/io/SharedPointer.hpp
     src/io/TXTReader.cpp
     src/io/TXTReader.hpp
@@ -163,6 +177,7 @@ target_sources(precice
     src/m2n/SharedPointer.hpp
     src/m2n/config/M2NConfiguration.cpp
     src/m2n/config/M2NConfiguration.hpp
+    src/mapping/LocalRadialBasisFctMapping.hpp
     src/mapping/Mapping.cpp
     src/mapping/Mapping.hpp
     src/mapping/NearestNeighborMapping.cpp
@@ -247,6 +262,7 @@ target_sources(precice
     src/query/FindClosestTriangle.hpp
     src/query/FindClosestVertex.cpp
     src/query/FindClosestVertex.hpp
+    src/utils/BinaryIO.hpp
     src/utils/Dimensions.cpp
     src/utils/Dimensions.hpp
     src/utils/EigenHelperFunctions.cpp
@@ -274,6 +290,8 @@ target_sources(precice
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/ThreadPool.cpp
+    src/utils/ThreadPool.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
@@ -16,6 +16,7 @@ target_sources(testprecice
     src/com/tests/MPIDirectCommunicationTest.cpp
     src/com/tests/MPIPortsCommunicationTest.cpp
     src/com/tests/MPISinglePortsCommunicationTest.cpp
+    src/com/tests/SharedMemoryCommunicationTest.cpp
     src/com/tests/SocketCommunicationTest.cpp
     src/cplscheme/tests/AbsoluteConvergenceMeasureTest.cpp
     src/cplscheme/tests/CompositionalCouplingSchemeTest.cpp
@@ -28,12 +29,15 @@ target_sources(testprecice
     src/cplscheme/tests/ResidualRelativeConvergenceMeasureTest.cpp
     src/cplscheme/tests/SerialImplicitCouplingSchemeTest.cpp
     src/io/tests/ExportConfigurationTest.cpp
+    src/io/tests/ExportQueueTest.cpp
     src/io/tests/ExportVTKTest.cpp
     src/io/tests/ExportVTKXMLTest.cpp
+    src/io/tests/ExportXDMFTest.cpp
     src/io/tests/TXTTableWriterTest.cpp
     src/io/tests/TXTWriterReaderTest.cpp
     src/m2n/tests/GatherScatterCommunicationTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
+    src/mapping/tests/LocalRadialBasisFctMappingTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborMappingTest.cpp
     src/mapping/tests/NearestProjectionMappingTest.cpp
@@ -74,6 +78,7 @@ target_sources(testprecice
     src/utils/tests/PointerVectorTest.cpp
     src/utils/tests/StatisticsTest.cpp
     src/utils/tests/StringTest.cpp
+    src/utils/tests/ThreadPoolTest.cpp
     src/xml/tests/ParserTest.cpp
     src/xml/tests/PrinterTest.cpp
     src/xml/tests/XMLTest.cpp
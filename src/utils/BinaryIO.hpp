@@ -0,0 +1,123 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/// Writes a value of arithmetic type in its binary representation.
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type writeBinary(std::ostream &out, T value)
+{
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/// Reads a value of arithmetic type written by writeBinary().
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type readBinary(std::istream &in, T &value)
+{
+  in.read(reinterpret_cast<char *>(&value), sizeof(T));
+}
+
+/// Writes the dimensions and the coefficients of a dense matrix or vector.
+template <typename Derived>
+void writeBinary(std::ostream &out, const Eigen::PlainObjectBase<Derived> &matrix)
+{
+  writeBinary(out, static_cast<std::int64_t>(matrix.rows()));
+  writeBinary(out, static_cast<std::int64_t>(matrix.cols()));
+  out.write(reinterpret_cast<const char *>(matrix.data()), matrix.size() * sizeof(typename Derived::Scalar));
+}
+
+/// Reads a dense matrix or vector written by writeBinary() and resizes it accordingly.
+template <typename Derived>
+void readBinary(std::istream &in, Eigen::PlainObjectBase<Derived> &matrix)
+{
+  std::int64_t rows = 0;
+  std::int64_t cols = 0;
+  readBinary(in, rows);
+  readBinary(in, cols);
+  if (not in || rows < 0 || cols < 0) {
+    in.setstate(std::ios::failbit);
+    return;
+  }
+  matrix.resize(rows, cols);
+  in.read(reinterpret_cast<char *>(matrix.data()), matrix.size() * sizeof(typename Derived::Scalar));
+}
+
+/// Writes the size and the elements of a vector.
+template <typename T>
+void writeBinary(std::ostream &out, const std::vector<T> &values)
+{
+  writeBinary(out, static_cast<std::int64_t>(values.size()));
+  for (const T &value : values) {
+    writeBinary(out, value);
+  }
+}
+
+/// Reads a vector written by writeBinary() and resizes it accordingly.
+template <typename T>
+void readBinary(std::istream &in, std::vector<T> &values)
+{
+  std::int64_t size = 0;
+  readBinary(in, size);
+  values.clear();
+  for (std::int64_t i = 0; i < size && in; i++) {
+    T value;
+    readBinary(in, value);
+    values.push_back(value);
+  }
+}
+
+/// Writes the size and the elements of a deque.
+template <typename T>
+void writeBinary(std::ostream &out, const std::deque<T> &values)
+{
+  writeBinary(out, static_cast<std::int64_t>(values.size()));
+  for (const T &value : values) {
+    writeBinary(out, value);
+  }
+}
+
+/// Reads a deque written by writeBinary() and resizes it accordingly.
+template <typename T>
+void readBinary(std::istream &in, std::deque<T> &values)
+{
+  std::int64_t size = 0;
+  readBinary(in, size);
+  values.clear();
+  for (std::int64_t i = 0; i < size && in; i++) {
+    T value;
+    readBinary(in, value);
+    values.push_back(value);
+  }
+}
+
+/// Writes the length and the characters of a string.
+inline void writeBinary(std::ostream &out, const std::string &value)
+{
+  writeBinary(out, static_cast<std::int64_t>(value.size()));
+  out.write(value.data(), value.size());
+}
+
+/// Reads a string written by writeBinary().
+inline void readBinary(std::istream &in, std::string &value)
+{
+  std::int64_t size = 0;
+  readBinary(in, size);
+  if (not in || size < 0) {
+    in.setstate(std::ios::failbit);
+    return;
+  }
+  value.resize(size);
+  in.read(&value[0], size);
+}
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,141 @@
+#include "utils/ThreadPool.hpp"
+#include <exception>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+namespace {
+/// True, if the current thread is executing a chunk of a loop
+thread_local bool insideLoop = false;
+} // namespace
+
+ThreadPool &ThreadPool::instance()
+{
+  static ThreadPool instance;
+  return instance;
+}
+
+ThreadPool::~ThreadPool()
+{
+  stopWorkers();
+}
+
+void ThreadPool::setThreads(int threads)
+{
+  PRECICE_TRACE(threads);
+  PRECICE_ASSERT(threads >= 1, threads);
+  PRECICE_ASSERT(not insideLoop);
+  PRECICE_ASSERT(not logging::isDeferringErrors());
+  if (threads == getThreads()) {
+    return;
+  }
+  stopWorkers();
+  for (int i = 1; i < threads; ++i) {
+    _workers.emplace_back(&ThreadPool::work, this);
+  }
+  PRECICE_DEBUG("Using " << threads << " threads");
+}
+
+int ThreadPool::getThreads() const
+{
+  return _workers.size() + 1;
+}
+
+void ThreadPool::run(std::size_t chunks, const std::function<void(std::size_t)> &task)
+{
+  PRECICE_ASSERT(chunks >= 1);
+  if (insideLoop) {
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+      task(chunk);
+    }
+    return;
+  }
+
+  std::mutex              doneMutex;
+  std::condition_variable done;
+  std::size_t             remaining = chunks - 1;
+  std::exception_ptr      error;
+
+  auto runChunk = [&](std::size_t chunk) {
+    try {
+      task(chunk);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(doneMutex);
+      if (not error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+      _tasks.emplace_back([&, chunk] {
+        runChunk(chunk);
+        // Notify while holding the lock, as the waiting thread destroys the condition afterwards
+        std::lock_guard<std::mutex> lock(doneMutex);
+        if (--remaining == 0) {
+          done.notify_one();
+        }
+      });
+    }
+  }
+  _condition.notify_all();
+
+  // Errors of the first chunk are reported once all other chunks finished, too
+  insideLoop = true;
+  logging::setDeferErrors(true);
+  runChunk(0);
+  logging::setDeferErrors(false);
+  insideLoop = false;
+
+  {
+    std::unique_lock<std::mutex> lock(doneMutex);
+    done.wait(lock, [&] { return remaining == 0; });
+  }
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    } catch (logging::DeferredError &deferred) {
+      logging::exitWithError(deferred.logger, deferred.location, deferred.message);
+    }
+  }
+}
+
+void ThreadPool::work()
+{
+  insideLoop = true;
+  logging::setDeferErrors(true);
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this] { return _stop || not _tasks.empty(); });
+      if (_tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+void ThreadPool::stopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _condition.notify_all();
+  for (auto &worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+  _stop = false;
+}
+
+} // namespace utils
+} // namespace precice
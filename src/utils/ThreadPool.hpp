@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Pool of worker threads, which runs the loops of compute kernels in parallel.
+ *
+ * The amount of threads is configured per participant using the tag <threads>.
+ * Using one thread, which is the default, all loops are executed serially by the calling thread.
+ *
+ * A loop distributed over the pool may only write to memory, which is not touched by other
+ * iterations of the loop. This keeps the results independent of the amount of threads.
+ *
+ * Errors raised by PRECICE_ERROR or PRECICE_CHECK inside a loop are deferred, see logging::setDeferErrors().
+ * The calling thread reports the first error and exits, once all threads finished their chunks.
+ */
+class ThreadPool {
+public:
+  /// Returns the only instance (singleton) of the ThreadPool class
+  static ThreadPool &instance();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// Stops and joins all workers.
+  ~ThreadPool();
+
+  /// Sets the amount of threads including the calling thread and restarts the workers.
+  void setThreads(int threads);
+
+  /// Returns the amount of threads including the calling thread.
+  int getThreads() const;
+
+  /**
+   * @brief Calls function(i) for every i in [begin, end) and returns once all calls finished.
+   *
+   * The range is split into one contiguous chunk per thread, the calling thread processes the first chunk.
+   * Loops started from inside another loop are executed serially.
+   */
+  template <typename Function>
+  void parallelFor(std::size_t begin, std::size_t end, Function function);
+
+  /**
+   * @brief Calls function(i) for every i in [begin, end), where the cost of iteration i is proportional to end - i.
+   *
+   * This is the case for loops over the upper triangle of a matrix. The range is split into contiguous chunks
+   * of equal total cost instead of equal length, such that the first chunk is the shortest one.
+   */
+  template <typename Function>
+  void parallelForTriangular(std::size_t begin, std::size_t end, Function function);
+
+private:
+  ThreadPool() = default;
+
+  /// Calls task(chunk) for every chunk in [0, chunks) using all threads and waits for completion.
+  void run(std::size_t chunks, const std::function<void(std::size_t)> &task);
+
+  /// Main loop of the worker threads.
+  void work();
+
+  void stopWorkers();
+
+  logging::Logger _log{"utils::ThreadPool"};
+
+  std::vector<std::thread> _workers;
+
+  std::deque<std::function<void()>> _tasks;
+
+  std::mutex _mutex;
+
+  std::condition_variable _condition;
+
+  bool _stop = false;
+};
+
+template <typename Function>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, Function function)
+{
+  if (end <= begin) {
+    return;
+  }
+  const std::size_t size   = end - begin;
+  const std::size_t chunks = std::min(size, _workers.size() + 1);
+  if (chunks == 1) {
+    for (std::size_t i = begin; i < end; ++i) {
+      function(i);
+    }
+    return;
+  }
+  run(chunks, [&](std::size_t chunk) {
+    const std::size_t chunkBegin = begin + chunk * size / chunks;
+    const std::size_t chunkEnd   = begin + (chunk + 1) * size / chunks;
+    for (std::size_t i = chunkBegin; i < chunkEnd; ++i) {
+      function(i);
+    }
+  });
+}
+
+template <typename Function>
+void ThreadPool::parallelForTriangular(std::size_t begin, std::size_t end, Function function)
+{
+  if (end <= begin) {
+    return;
+  }
+  const std::size_t size   = end - begin;
+  const std::size_t chunks = std::min(size, _workers.size() + 1);
+  if (chunks == 1) {
+    for (std::size_t i = begin; i < end; ++i) {
+      function(i);
+    }
+    return;
+  }
+  // The cost of [i, end) is proportional to (end - i)^2, every chunk takes 1 / chunks of the total cost
+  const auto chunkBegin = [&](std::size_t chunk) -> std::size_t {
+    if (chunk == chunks) {
+      return end;
+    }
+    const double remaining = std::sqrt(1.0 - static_cast<double>(chunk) / chunks);
+    return end - std::min(size, static_cast<std::size_t>(std::llround(size * remaining)));
+  };
+  run(chunks, [&](std::size_t chunk) {
+    for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); ++i) {
+      function(i);
+    }
+  });
+}
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,116 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "logging/Logger.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ThreadPoolTests)
+
+BOOST_AUTO_TEST_CASE(ParallelFor)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  for (int threads : {1, 2, 4}) {
+    pool.setThreads(threads);
+    BOOST_TEST(pool.getThreads() == threads);
+
+    std::vector<int> visits(1000, 0);
+    pool.parallelFor(0, visits.size(), [&](size_t i) { visits[i] += static_cast<int>(i); });
+    for (size_t i = 0; i < visits.size(); ++i) {
+      BOOST_TEST(visits[i] == static_cast<int>(i));
+    }
+
+    // Ranges smaller than the amount of threads and empty ranges
+    std::vector<int> small(3, 0);
+    pool.parallelFor(1, 3, [&](size_t i) { small[i] = 1; });
+    BOOST_TEST(small == std::vector<int>({0, 1, 1}));
+    pool.parallelFor(2, 2, [&](size_t i) { small[i] = 2; });
+    BOOST_TEST(small == std::vector<int>({0, 1, 1}));
+  }
+  pool.setThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(Nested)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.setThreads(3);
+  std::atomic<int> count{0};
+  pool.parallelFor(0, 10, [&](size_t) {
+    pool.parallelFor(0, 10, [&](size_t) { ++count; });
+  });
+  BOOST_TEST(count == 100);
+  pool.setThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(Exception)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.setThreads(2);
+  auto failingLoop = [&pool] {
+    pool.parallelFor(0, 10, [](size_t i) {
+      if (i == 7) {
+        throw std::runtime_error("Failure");
+      }
+    });
+  };
+  BOOST_CHECK_THROW(failingLoop(), std::runtime_error);
+
+  // The pool is still usable afterwards
+  std::atomic<int> count{0};
+  pool.parallelFor(0, 10, [&](size_t) { ++count; });
+  BOOST_TEST(count == 10);
+  pool.setThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(Triangular)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  for (int threads : {1, 2, 3, 4}) {
+    pool.setThreads(threads);
+    for (size_t size : {1, 2, 5, 100}) {
+      std::vector<int> visits(size + 3, 0);
+      pool.parallelForTriangular(3, visits.size(), [&](size_t i) { ++visits[i]; });
+      for (size_t i = 0; i < visits.size(); ++i) {
+        BOOST_TEST(visits[i] == (i < 3 ? 0 : 1));
+      }
+    }
+  }
+  pool.setThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredErrors)
+{
+  PRECICE_TEST(1_rank);
+  auto &pool = ThreadPool::instance();
+  pool.setThreads(3);
+
+  // Errors are deferred on all threads running a loop, but not outside of loops
+  std::vector<int> deferred(10, 0);
+  pool.parallelFor(0, deferred.size(), [&](size_t i) { deferred[i] = logging::isDeferringErrors(); });
+  BOOST_TEST(deferred == std::vector<int>(10, 1));
+  BOOST_TEST(not logging::isDeferringErrors());
+  pool.setThreads(1);
+
+  // PRECICE_ERROR throws instead of exiting, if errors are deferred
+  logging::Logger _log{"ThreadPoolTest"};
+  logging::setDeferErrors(true);
+  try {
+    PRECICE_ERROR("Failure " << 42);
+    BOOST_TEST(false);
+  } catch (const logging::DeferredError &error) {
+    BOOST_TEST(error.message == "Failure 42");
+  }
+  logging::setDeferErrors(false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadPoolTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
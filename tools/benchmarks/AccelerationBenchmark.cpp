@@ -0,0 +1,114 @@
+#include <Eigen/Core>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "Benchmark.hpp"
+#include "acceleration/Acceleration.hpp"
+#include "acceleration/impl/ParallelMatrixOperations.hpp"
+#include "acceleration/impl/QRFactorization.hpp"
+#include "utils/MasterSlave.hpp"
+
+using namespace precice;
+
+PRECICE_BENCHMARK(QRFactorization)
+{
+  using acceleration::impl::QRFactorization;
+  const bool    parallel  = benchmarks::initializeMasterSlaves();
+  const int     ranks     = parallel ? utils::MasterSlave::getSize() : 1;
+  constexpr int localRows = 100000;
+  constexpr int columns   = 20;
+
+  const Eigen::MatrixXd V = Eigen::MatrixXd::Random(localRows, columns);
+
+  auto empty = [ranks] {
+    QRFactorization qr(acceleration::Acceleration::NOFILTER);
+    qr.setGlobalRows(localRows * ranks);
+    return qr;
+  };
+  const double insert = benchmarks::measure(5, [&] {
+    QRFactorization qr = empty();
+    for (int i = 0; i < columns; ++i) {
+      qr.pushBack(V.col(i));
+    }
+  });
+  const double append = benchmarks::measure(5, [&] {
+    QRFactorization qr = empty();
+    qr.appendColumns(V);
+  });
+
+  // Deletes every second column from a copy of the full factorization
+  QRFactorization full = empty();
+  full.appendColumns(V);
+  std::vector<int> deleted;
+  for (int i = 0; i < columns; i += 2) {
+    deleted.push_back(i);
+  }
+  const double copy = benchmarks::measure(5, [&] {
+    QRFactorization qr = full;
+  });
+  const double deleteOneByOne = benchmarks::measure(5, [&] {
+    QRFactorization qr = full;
+    for (auto it = deleted.rbegin(); it != deleted.rend(); ++it) {
+      qr.deleteColumn(*it);
+    }
+  });
+  const double deleteEnBloc = benchmarks::measure(5, [&] {
+    QRFactorization qr = full;
+    qr.deleteColumns(deleted);
+  });
+
+  std::cout << ranks << " ranks, " << localRows << " rows per rank\n";
+  std::cout << "                       one by one [ms]  en bloc [ms]\n";
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "insert " << columns << " columns   " << std::setw(18) << insert * 1e3 << std::setw(14) << append * 1e3 << '\n';
+  std::cout << "delete " << deleted.size() << " columns   " << std::setw(18) << (deleteOneByOne - copy) * 1e3
+            << std::setw(14) << (deleteEnBloc - copy) * 1e3 << '\n';
+
+  if (parallel) {
+    benchmarks::finalizeMasterSlaves();
+  }
+}
+
+#ifndef PRECICE_NO_MPI
+
+PRECICE_BENCHMARK(ParallelMatrixOperations)
+{
+  if (not benchmarks::initializeMasterSlaves()) {
+    std::cout << "The matrix products run on several ranks, run: mpirun -np N benchprecice ParallelMatrixOperations\n";
+    return;
+  }
+
+  const int        ranks = utils::MasterSlave::getSize();
+  constexpr int    n     = 4000;
+  constexpr int    m     = 20;
+  std::vector<int> offsets(ranks + 1);
+  for (int rank = 0; rank <= ranks; ++rank) {
+    offsets[rank] = rank * n / ranks;
+  }
+  const int localRows = offsets[utils::MasterSlave::getRank() + 1] - offsets[utils::MasterSlave::getRank()];
+
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(localRows, m);
+  Eigen::MatrixXd Z = Eigen::MatrixXd::Random(m, localRows);
+  Eigen::MatrixXd J = Eigen::MatrixXd::Random(n, localRows);
+  Eigen::MatrixXd WZ(n, localRows);
+  Eigen::MatrixXd JW(localRows, m);
+
+  std::cout << ranks << " ranks, n = " << n << ", m = " << m << '\n';
+  std::cout << "     variant  W * Z, n x n [ms]  J * W, block-wise [ms]\n";
+  for (bool useCollectives : {false, true}) {
+    acceleration::impl::ParallelMatrixOperations operations;
+    operations.initialize(true, useCollectives);
+    const double nn = benchmarks::measure(10, [&] {
+      operations.multiply(W, Z, WZ, offsets, n, m, n);
+    });
+    const double nm = benchmarks::measure(10, [&] {
+      operations.multiply(J, W, JW, offsets, n, n, m, false);
+    });
+    std::cout << std::setw(12) << (useCollectives ? "collectives" : "ring") << std::setw(19) << std::fixed << std::setprecision(1) << nn * 1e3
+              << std::setw(24) << nm * 1e3 << '\n';
+  }
+
+  benchmarks::finalizeMasterSlaves();
+}
+
+#endif // not PRECICE_NO_MPI
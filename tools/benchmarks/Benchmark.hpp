@@ -0,0 +1,42 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace precice {
+namespace benchmarks {
+
+/// A benchmark prints its results to stdout.
+using Benchmark = std::function<void()>;
+
+/// Registers a benchmark, returns true to allow the registration during static initialization.
+bool registerBenchmark(std::string const &name, Benchmark benchmark);
+
+/// Runs the function once as warm-up, returns the mean wall time of the repetitions in seconds.
+double measure(int repetitions, std::function<void()> const &function);
+
+/// Returns 1 and the amount of hardware threads, the thread counts used for components running on the ThreadPool.
+std::vector<int> threadCounts();
+
+/**
+ * @brief Connects master and slaves, if the benchmark runs on several MPI ranks.
+ *
+ * Only the master prints to stdout. Returns false on a single rank.
+ */
+bool initializeMasterSlaves();
+
+/// Disconnects master and slaves connected by initializeMasterSlaves().
+void finalizeMasterSlaves();
+
+/// Returns a new ID for a mesh of a benchmark, as meshes share the cached R-trees by ID.
+int nextMeshID();
+
+} // namespace benchmarks
+} // namespace precice
+
+/// Defines and registers the benchmark "name", the body of the benchmark follows the macro.
+#define PRECICE_BENCHMARK(name)                                                                             \
+  static void      benchmark_##name();                                                                      \
+  static const bool registered_##name = precice::benchmarks::registerBenchmark(#name, &benchmark_##name); \
+  static void      benchmark_##name()
@@ -0,0 +1,183 @@
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SocketCommunication.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+
+namespace {
+
+constexpr int pingPongs = 20000;
+
+/// Message sizes of the bandwidth measurement, in doubles
+const std::vector<std::size_t> messageSizes{1 << 7, 1 << 10, 1 << 13, 1 << 16, 1 << 19, 1 << 22};
+
+/// Every bandwidth measurement transfers about this amount of bytes
+constexpr std::size_t bytesPerSize = 1 << 28;
+
+int repetitions(std::size_t messageSize)
+{
+  return std::max<std::size_t>(bytesPerSize / (messageSize * sizeof(double)), 1);
+}
+
+struct Results {
+  double              latency;
+  std::vector<double> bandwidths;
+};
+
+/// Answers the pings and acknowledges the messages of measure().
+template <typename Com>
+void echo(Com &com)
+{
+  double value = 0.0;
+  for (int i = 0; i < pingPongs + 1; ++i) {
+    com.receive(value, 0);
+    com.send(value, 0);
+  }
+  for (std::size_t size : messageSizes) {
+    std::vector<double> message(size);
+    for (int i = 0; i < repetitions(size) + 1; ++i) {
+      com.receive(message.data(), static_cast<int>(size), 0);
+      com.send(1, 0);
+    }
+  }
+}
+
+/// Measures the one-way latency of a double and the bandwidth of blocking sends to the process running echo().
+template <typename Com>
+Results measure(Com &com)
+{
+  Results results;
+  double  value = 1.0;
+  results.latency = benchmarks::measure(pingPongs, [&] {
+                      com.send(value, 0);
+                      com.receive(value, 0);
+                    }) / 2;
+  for (std::size_t size : messageSizes) {
+    std::vector<double> message(size, 1.0);
+    int                 ack     = 0;
+    const double        seconds = benchmarks::measure(repetitions(size), [&] {
+      com.send(message.data(), static_cast<int>(size), 0);
+      com.receive(ack, 0);
+    });
+    results.bandwidths.push_back(size * sizeof(double) / seconds);
+  }
+  return results;
+}
+
+/// Forks a process for the requesting side, such that both sides run on the same node.
+template <typename Com>
+Results pingPong()
+{
+  std::cout.flush();
+  const pid_t requester = fork();
+  if (requester == 0) {
+    Com com;
+    com.requestConnection("Acceptor", "Requester", "", 0, 1);
+    echo(com);
+    com.closeConnection();
+    _exit(0);
+  }
+  Results results;
+  {
+    Com com;
+    com.acceptConnection("Acceptor", "Requester", "", 0);
+    results = measure(com);
+    com.closeConnection();
+  }
+  waitpid(requester, nullptr, 0);
+  return results;
+}
+
+/// Returns the mean time of the operation, measured until all ranks finished their repetitions.
+double collectiveLatency(std::function<void()> const &operation)
+{
+  constexpr int repetitions = 200;
+  return benchmarks::measure(1, [&] {
+           for (int i = 0; i < repetitions; ++i) {
+             operation();
+           }
+           utils::Parallel::current()->synchronize();
+         }) /
+         repetitions;
+}
+
+} // namespace
+
+PRECICE_BENCHMARK(Collectives)
+{
+  const int rank = utils::Parallel::current()->rank();
+  const int size = utils::Parallel::current()->size();
+  if (size == 1) {
+    std::cout << "The collectives run on several ranks, run: mpirun -np N benchprecice Collectives\n";
+    return;
+  }
+  com::SocketCommunication com;
+  com.connectMasterSlaves("Benchmark", "", rank, size);
+  const bool isMaster = rank == 0;
+
+  // The qualified calls of Communication run the linear operations, which loop over all slaves on the master
+  const std::vector<std::pair<std::string, std::function<void()>>> linear{
+      {"allreduce", [&] {
+         double sum = 0.0;
+         isMaster ? com.Communication::allreduceSum(1.0, sum) : com.Communication::allreduceSum(1.0, sum, 0);
+       }},
+      {"broadcast", [&] {
+         double value = 1.0;
+         isMaster ? com.Communication::broadcast(value) : com.Communication::broadcast(value, 0);
+       }}};
+  const std::vector<std::pair<std::string, std::function<void()>>> tree{
+      {"allreduce", [&] {
+         double sum = 0.0;
+         isMaster ? com.allreduceSum(1.0, sum) : com.allreduceSum(1.0, sum, 0);
+       }},
+      {"broadcast", [&] {
+         double value = 1.0;
+         isMaster ? com.broadcast(value) : com.broadcast(value, 0);
+       }}};
+
+  std::cout << size << " ranks, latency of a double over sockets\n";
+  std::cout << "   operation  linear [us]    tree [us]\n";
+  for (std::size_t i = 0; i < linear.size(); ++i) {
+    const double linearLatency = collectiveLatency(linear[i].second);
+    const double treeLatency   = collectiveLatency(tree[i].second);
+    std::cout << std::setw(12) << linear[i].first << std::fixed << std::setprecision(1)
+              << std::setw(13) << linearLatency * 1e6 << std::setw(13) << treeLatency * 1e6 << '\n';
+  }
+  com.closeConnection();
+}
+
+PRECICE_BENCHMARK(Communication)
+{
+  std::vector<std::pair<std::string, Results>> results;
+  results.emplace_back("sockets", pingPong<com::SocketCommunication>());
+#ifndef PRECICE_NO_SHM
+  results.emplace_back("shm", pingPong<com::SharedMemoryCommunication>());
+#endif
+
+  std::cout << std::setw(28) << "";
+  for (auto const &result : results) {
+    std::cout << std::setw(12) << result.first;
+  }
+  std::cout << "\nlatency [us]                ";
+  for (auto const &result : results) {
+    std::cout << std::setw(12) << std::fixed << std::setprecision(2) << result.second.latency * 1e6;
+  }
+  for (std::size_t i = 0; i < messageSizes.size(); ++i) {
+    std::cout << "\nbandwidth [MB/s], " << std::setw(8) << messageSizes[i] * sizeof(double) << " B";
+    for (auto const &result : results) {
+      std::cout << std::setw(12) << std::setprecision(0) << result.second.bandwidths[i] / 1e6;
+    }
+  }
+  std::cout << '\n';
+}
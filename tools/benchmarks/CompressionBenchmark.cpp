@@ -0,0 +1,49 @@
+#ifndef PRECICE_NO_ZLIB
+
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "com/DataCompressor.hpp"
+
+using namespace precice;
+
+PRECICE_BENCHMARK(Compression)
+{
+  // Smooth values, as typical for coupling data
+  constexpr std::size_t size = 1 << 20;
+  std::vector<double>   values(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    values[i] = std::sin(1e-4 * i) + 1e-3 * std::cos(1e-2 * i);
+  }
+
+  const std::vector<std::pair<std::string, com::DataCompressor>> compressors{
+      {"lossless", com::DataCompressor(com::DataCompressor::Mode::Lossless)},
+      {"lossy, 1e-6", com::DataCompressor(com::DataCompressor::Mode::Lossy, 1e-6)}};
+
+  std::cout << size << " doubles\n";
+  std::cout << "      compression   ratio  compress [MB/s]  decompress [MB/s]\n";
+  for (auto const &compressor : compressors) {
+    std::vector<unsigned char> message;
+    std::vector<double>        decompressed(size);
+    // The payload follows the header of the message
+    const std::size_t header = sizeof(com::DataCompressor::Header);
+
+    const double compress = benchmarks::measure(20, [&] {
+      compressor.second.compress(values.data(), size, message);
+    });
+    const double decompress = benchmarks::measure(20, [&] {
+      compressor.second.decompress(message.data() + header, message.size() - header, decompressed.data(), size);
+    });
+
+    const double bytes = size * sizeof(double);
+    std::cout << std::setw(17) << compressor.first << std::setw(8) << std::fixed << std::setprecision(2) << bytes / message.size()
+              << std::setw(17) << std::setprecision(0) << bytes / compress / 1e6 << std::setw(19) << bytes / decompress / 1e6 << '\n';
+  }
+}
+
+#endif // not PRECICE_NO_ZLIB
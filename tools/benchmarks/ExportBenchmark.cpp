@@ -0,0 +1,69 @@
+#include <boost/filesystem.hpp>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "Meshes.hpp"
+#include "io/ExportVTKXML.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+
+PRECICE_BENCHMARK(VTUExport)
+{
+  if (not benchmarks::initializeMasterSlaves()) {
+    std::cout << "The VTU export runs on several ranks, run: mpirun -np N benchprecice VTUExport\n";
+    return;
+  }
+
+  // Every rank exports its own grid
+  mesh::Mesh mesh("Export", 3, false, benchmarks::nextMeshID());
+  benchmarks::createCurvedGrid(mesh, 500, true, utils::MasterSlave::getRank());
+  mesh.createData("Scalar", 1);
+  mesh.createData("Vector", 3);
+  mesh.allocateDataValues();
+  for (auto &data : mesh.data()) {
+    data->values().setLinSpaced(0.0, 1.0);
+  }
+  mesh.computeState();
+  if (utils::MasterSlave::isMaster()) {
+    for (int rank = 0; rank < utils::MasterSlave::getSize(); ++rank) {
+      mesh.getVertexDistribution()[rank] = {rank};
+    }
+  }
+
+  const std::vector<std::pair<std::string, io::ExportVTKXML::Format>> formats{
+      {"ascii", io::ExportVTKXML::Format::ASCII},
+      {"binary", io::ExportVTKXML::Format::Binary},
+#ifndef PRECICE_NO_ZLIB
+      {"compressed", io::ExportVTKXML::Format::Compressed},
+#endif
+  };
+
+  const auto directory = boost::filesystem::temp_directory_path() / "precice-benchmark-vtu";
+  std::cout << utils::MasterSlave::getSize() << " ranks, each exports " << mesh.vertices().size() << " vertices and "
+            << mesh.triangles().size() << " triangles with normals, scalar and 3D vector data\n";
+  std::cout << "     format  time of the master [ms]  file size per rank [MB]\n";
+  for (auto const &format : formats) {
+    io::ExportVTKXML exporter(true, format.second);
+    const double     seconds = benchmarks::measure(3, [&] {
+      exporter.doExport("Benchmark", directory.string(), mesh);
+    });
+    std::cout << std::setw(11) << format.first << std::setw(25) << std::fixed << std::setprecision(0) << seconds * 1e3;
+    if (utils::MasterSlave::isMaster()) {
+      std::cout << std::setw(25) << std::setprecision(1) << boost::filesystem::file_size(directory / "Benchmark_r0.vtu") / 1e6;
+    }
+    std::cout << '\n';
+  }
+
+  utils::Parallel::current()->synchronize();
+  if (utils::MasterSlave::isMaster()) {
+    boost::filesystem::remove_all(directory);
+  }
+  benchmarks::finalizeMasterSlaves();
+}
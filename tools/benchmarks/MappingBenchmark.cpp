@@ -0,0 +1,118 @@
+#include <Eigen/Core>
+#include <iomanip>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "Meshes.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Creates a scalar and a vector data field with linearly increasing values.
+void createData(mesh::Mesh &mesh)
+{
+  mesh.createData("Scalar", 1);
+  mesh.createData("Vector", 3);
+  mesh.allocateDataValues();
+  for (auto &data : mesh.data()) {
+    data->values().setLinSpaced(0.0, 1.0);
+  }
+}
+
+/// Prints the mean time of mapping the scalar data, the vector data, and both at once with mapBatch().
+void measureMapping(std::string const &name, mapping::Mapping &mapping)
+{
+  mapping.computeMapping();
+  const auto &inputData  = mapping.getInputMesh()->data();
+  const auto &outputData = mapping.getOutputMesh()->data();
+
+  const std::vector<std::pair<std::string, std::function<void()>>> cases{
+      {"scalar", [&] { mapping.map(inputData[0]->getID(), outputData[0]->getID()); }},
+      {"vector", [&] { mapping.map(inputData[1]->getID(), outputData[1]->getID()); }},
+      {"batch", [&] { mapping.mapBatch({inputData[0]->getID(), inputData[1]->getID()},
+                                       {outputData[0]->getID(), outputData[1]->getID()}); }}};
+  for (int threads : benchmarks::threadCounts()) {
+    utils::ThreadPool::instance().setThreads(threads);
+    std::cout << std::setw(14) << name << std::setw(9) << threads;
+    for (auto const &mappingCase : cases) {
+      std::cout << std::setw(12) << std::fixed << std::setprecision(2) << benchmarks::measure(20, mappingCase.second) * 1e3;
+    }
+    std::cout << '\n';
+  }
+  utils::ThreadPool::instance().setThreads(1);
+}
+
+void printHeader()
+{
+  std::cout << "    constraint  threads  scalar [ms] vector [ms]  batch [ms]\n";
+}
+
+} // namespace
+
+PRECICE_BENCHMARK(NearestNeighborMapping)
+{
+  // Grids of n^3 vertices, the output grid is shifted by less than half the spacing
+  constexpr int n = 100;
+  auto          input  = std::make_shared<mesh::Mesh>("Input", 3, false, benchmarks::nextMeshID());
+  auto          output = std::make_shared<mesh::Mesh>("Output", 3, false, benchmarks::nextMeshID());
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        input->createVertex(Eigen::Vector3d(i, j, k));
+        output->createVertex(Eigen::Vector3d(i + 0.3, j + 0.3, k + 0.3));
+      }
+    }
+  }
+  createData(*input);
+  createData(*output);
+
+  std::cout << "grids of " << input->vertices().size() << " vertices, scalar and 3D vector data\n";
+  printHeader();
+  {
+    mapping::NearestNeighborMapping consistent(mapping::Mapping::CONSISTENT, 3);
+    consistent.setMeshes(input, output);
+    measureMapping("consistent", consistent);
+  }
+  {
+    mapping::NearestNeighborMapping conservative(mapping::Mapping::CONSERVATIVE, 3);
+    conservative.setMeshes(output, input);
+    measureMapping("conservative", conservative);
+  }
+}
+
+PRECICE_BENCHMARK(NearestProjectionMapping)
+{
+  // The points lie on a finer grid, which is shifted with respect to the triangulated surface
+  auto surface = std::make_shared<mesh::Mesh>("Surface", 3, false, benchmarks::nextMeshID());
+  auto points  = std::make_shared<mesh::Mesh>("Points", 3, false, benchmarks::nextMeshID());
+  benchmarks::createCurvedGrid(*surface, 500, true);
+  benchmarks::createCurvedGrid(*points, 1000, false, 0.37);
+  createData(*surface);
+  createData(*points);
+
+  std::cout << "surface of " << surface->triangles().size() << " triangles, " << points->vertices().size()
+            << " points, scalar and 3D vector data\n";
+  printHeader();
+  {
+    mapping::NearestProjectionMapping consistent(mapping::Mapping::CONSISTENT, 3);
+    consistent.setMeshes(surface, points);
+    measureMapping("consistent", consistent);
+  }
+  {
+    mapping::NearestProjectionMapping conservative(mapping::Mapping::CONSERVATIVE, 3);
+    conservative.setMeshes(points, surface);
+    measureMapping("conservative", conservative);
+  }
+}
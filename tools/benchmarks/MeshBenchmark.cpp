@@ -0,0 +1,86 @@
+#include <Eigen/Core>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include "Benchmark.hpp"
+#include "Meshes.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/ThreadPool.hpp"
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+#include <malloc.h>
+#define PRECICE_BENCHMARK_MALLINFO
+#endif
+
+using namespace precice;
+
+namespace {
+
+/// Returns the bytes currently allocated on the heap, or 0 if the C library cannot tell.
+std::size_t allocatedBytes()
+{
+#ifdef PRECICE_BENCHMARK_MALLINFO
+  // Includes the allocations of Eigen, which bypass operator new
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+} // namespace
+
+PRECICE_BENCHMARK(MeshVertices)
+{
+  constexpr int vertices = 1000000;
+
+  const std::size_t before = allocatedBytes();
+  mesh::Mesh        mesh("Vertices", 3, false, benchmarks::nextMeshID());
+  for (int i = 0; i < vertices; ++i) {
+    mesh.createVertex(Eigen::Vector3d(i, 0.5 * i, 0.25 * i));
+  }
+  const std::size_t allocated = allocatedBytes() - before;
+
+  const double create = benchmarks::measure(5, [] {
+    mesh::Mesh mesh("Vertices", 3, false, benchmarks::nextMeshID());
+    for (int i = 0; i < vertices; ++i) {
+      mesh.createVertex(Eigen::Vector3d(i, 0.5 * i, 0.25 * i));
+    }
+  });
+
+  double sum = 0.0;
+
+  const double iterate = benchmarks::measure(10, [&] {
+    for (auto const &vertex : mesh.vertices()) {
+      sum += vertex.getCoords().sum();
+    }
+  });
+
+  std::cout << "3D vertices                    " << vertices << '\n';
+  std::cout << "size of a vertex [B]           " << sizeof(mesh::Vertex) << '\n';
+  std::cout << std::fixed << std::setprecision(1);
+  if (before > 0) {
+    std::cout << "allocated heap memory [MB]     " << allocated / 1e6 << '\n';
+  } else {
+    std::cout << "allocated heap memory [MB]     not available without mallinfo2() of glibc\n";
+  }
+  std::cout << "create and destroy [ms]        " << create * 1e3 << '\n';
+  std::cout << "sum up the coordinates [ms]    " << iterate * 1e3 << '\n';
+  std::cout << "checksum                       " << std::scientific << sum << '\n';
+}
+
+PRECICE_BENCHMARK(MeshNormals)
+{
+  constexpr int n = 708;
+  mesh::Mesh    mesh("Normals", 3, false, benchmarks::nextMeshID());
+  benchmarks::createCurvedGrid(mesh, n, true);
+
+  std::cout << "curved grid with " << mesh.vertices().size() << " vertices and " << mesh.triangles().size() << " triangles\n";
+  std::cout << "threads    computeState() [ms]\n";
+  for (int threads : benchmarks::threadCounts()) {
+    utils::ThreadPool::instance().setThreads(threads);
+    const double seconds = benchmarks::measure(5, [&] { mesh.computeState(); });
+    std::cout << std::setw(7) << threads << std::setw(22) << std::fixed << std::setprecision(1) << seconds * 1e3 << '\n';
+  }
+  utils::ThreadPool::instance().setThreads(1);
+}
@@ -0,0 +1,57 @@
+#include "Meshes.hpp"
+#include <Eigen/Core>
+#include <cmath>
+#include <vector>
+#include "math/constants.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+
+namespace precice {
+namespace benchmarks {
+
+void createCurvedGrid(mesh::Mesh &mesh, int n, bool triangulate, double offset)
+{
+  const double spacing = 1.0 / (n - 1);
+
+  auto height = [](double x, double y) {
+    return 0.1 * std::sin(2 * math::PI * x) * std::cos(2 * math::PI * y);
+  };
+
+  // Vertex (i, j) is at index i + j * n
+  std::vector<mesh::Vertex *> vertices;
+  vertices.reserve(n * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      const double x = (i + offset) * spacing;
+      const double y = (j + offset) * spacing;
+      vertices.push_back(&mesh.createVertex(Eigen::Vector3d(x, y, height(x, y))));
+    }
+  }
+  if (not triangulate) {
+    return;
+  }
+
+  auto vertex = [&](int i, int j) -> mesh::Vertex & {
+    return *vertices[i + j * n];
+  };
+  std::vector<mesh::Edge *> horizontal, vertical;
+  horizontal.reserve(n * n);
+  vertical.reserve(n * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      horizontal.push_back(i + 1 < n ? &mesh.createEdge(vertex(i, j), vertex(i + 1, j)) : nullptr);
+      vertical.push_back(j + 1 < n ? &mesh.createEdge(vertex(i, j), vertex(i, j + 1)) : nullptr);
+    }
+  }
+  for (int j = 0; j + 1 < n; ++j) {
+    for (int i = 0; i + 1 < n; ++i) {
+      mesh::Edge &diagonal = mesh.createEdge(vertex(i + 1, j), vertex(i, j + 1));
+      mesh.createTriangle(*horizontal[i + j * n], diagonal, *vertical[i + j * n]);
+      mesh.createTriangle(*horizontal[i + (j + 1) * n], diagonal, *vertical[i + 1 + j * n]);
+    }
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
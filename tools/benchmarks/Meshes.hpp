@@ -0,0 +1,21 @@
+#pragma once
+
+namespace precice {
+namespace mesh {
+class Mesh;
+} // namespace mesh
+
+namespace benchmarks {
+
+/**
+ * @brief Creates a grid of n x n vertices on the unit square, which is curved in z-direction.
+ *
+ * @param[in] mesh 3D mesh to create the vertices in
+ * @param[in] n number of vertices per side
+ * @param[in] triangulate creates the edges and two triangles per grid cell, if true
+ * @param[in] offset shift of the grid in x- and y-direction relative to the grid spacing
+ */
+void createCurvedGrid(mesh::Mesh &mesh, int n, bool triangulate, double offset = 0.0);
+
+} // namespace benchmarks
+} // namespace precice
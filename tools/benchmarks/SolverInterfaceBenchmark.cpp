@@ -0,0 +1,89 @@
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "precice/SolverInterface.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// The solver interface of the first participant is never initialized.
+const std::string configuration = R"(<?xml version="1.0" encoding="UTF-8" ?>
+<precice-configuration>
+  <log>
+    <sink type="stream" output="stdout" filter="%Severity% >= warning" enabled="true" />
+  </log>
+  <solver-interface dimensions="3">
+    <data:scalar name="Data" />
+    <mesh name="Mesh">
+      <use-data name="Data" />
+    </mesh>
+    <mesh name="OtherMesh">
+      <use-data name="Data" />
+    </mesh>
+    <participant name="Solver">
+      <use-mesh name="Mesh" provide="on" />
+      <write-data name="Data" mesh="Mesh" />
+    </participant>
+    <participant name="Other">
+      <use-mesh name="Mesh" from="Solver" />
+      <use-mesh name="OtherMesh" provide="on" />
+      <mapping:nearest-neighbor direction="read" from="Mesh" to="OtherMesh" constraint="consistent" />
+      <read-data name="Data" mesh="OtherMesh" />
+    </participant>
+    <m2n:sockets from="Solver" to="Other" />
+    <coupling-scheme:serial-explicit>
+      <participants first="Solver" second="Other" />
+      <max-time-windows value="1" />
+      <time-window-size value="1.0" />
+      <exchange data="Data" mesh="Mesh" from="Solver" to="Other" />
+    </coupling-scheme:serial-explicit>
+  </solver-interface>
+</precice-configuration>
+)";
+
+} // namespace
+
+PRECICE_BENCHMARK(VertexLookup)
+{
+  if (utils::Parallel::current()->size() != 1) {
+    std::cout << "The solver interface runs serially, run: benchprecice VertexLookup\n";
+    return;
+  }
+  const auto directory = boost::filesystem::temp_directory_path() / "precice-benchmark-lookup";
+  boost::filesystem::create_directories(directory);
+  const auto file = (directory / "precice-config.xml").string();
+  std::ofstream(file) << configuration;
+
+  std::cout << "vertices    getMeshVertexIDsFromPositions() of all vertices [ms]\n";
+  for (int n : {10, 30, 100, 300}) {
+    SolverInterface interface("Solver", file, 0, 1);
+    const int       meshID = interface.getMeshID("Mesh");
+
+    std::vector<double> positions;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        positions.insert(positions.end(), {1.0 + i, 1.0 + j, 0.5 * i - 0.25 * j});
+      }
+    }
+    const int        size = n * n;
+    std::vector<int> ids(size);
+    interface.setMeshVertices(meshID, size, positions.data(), ids.data());
+
+    // Query all vertices in reverse order
+    std::vector<double> queries(positions.rbegin(), positions.rend());
+    for (int i = 0; i < size; ++i) {
+      std::swap(queries[3 * i], queries[3 * i + 2]);
+    }
+    const double seconds = benchmarks::measure(5, [&] {
+      interface.getMeshVertexIDsFromPositions(meshID, size, queries.data(), ids.data());
+    });
+    std::cout << std::setw(8) << size << std::setw(52) << std::fixed << std::setprecision(2) << seconds * 1e3 << '\n';
+  }
+  boost::filesystem::remove_all(directory);
+}
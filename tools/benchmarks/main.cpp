@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+#ifndef PRECICE_NO_MPI
+#include "com/MPIDirectCommunication.hpp"
+#endif
+
+namespace precice {
+namespace benchmarks {
+
+namespace {
+std::map<std::string, Benchmark> &registry()
+{
+  static std::map<std::string, Benchmark> benchmarks;
+  return benchmarks;
+}
+} // namespace
+
+bool registerBenchmark(std::string const &name, Benchmark benchmark)
+{
+  registry().emplace(name, std::move(benchmark));
+  return true;
+}
+
+double measure(int repetitions, std::function<void()> const &function)
+{
+  using clock = std::chrono::steady_clock;
+  function();
+  const auto start = clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    function();
+  }
+  return std::chrono::duration<double>(clock::now() - start).count() / std::max(repetitions, 1);
+}
+
+std::vector<int> threadCounts()
+{
+  const int hardwareThreads = std::thread::hardware_concurrency();
+  if (hardwareThreads > 1) {
+    return {1, hardwareThreads};
+  }
+  return {1};
+}
+
+bool initializeMasterSlaves()
+{
+#ifndef PRECICE_NO_MPI
+  const int rank = utils::Parallel::current()->rank();
+  const int size = utils::Parallel::current()->size();
+  if (size == 1) {
+    return false;
+  }
+  utils::MasterSlave::configure(rank, size);
+  auto communication = std::make_shared<com::MPIDirectCommunication>();
+  communication->connectMasterSlaves("Benchmark", "", rank, size);
+  utils::MasterSlave::_communication = std::move(communication);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void finalizeMasterSlaves()
+{
+  utils::MasterSlave::_communication = nullptr;
+  utils::MasterSlave::reset();
+}
+
+int nextMeshID()
+{
+  static int id = 0;
+  return id++;
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+void printUsage()
+{
+  std::cout << "Usage:\n\n";
+  std::cout << "Run all benchmarks      :  benchprecice\n";
+  std::cout << "Run selected benchmarks :  benchprecice NAME...\n";
+  std::cout << "List all benchmarks     :  benchprecice list\n\n";
+  std::cout << "Benchmarks of parallel components run on all ranks, if started with mpirun." << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  using namespace precice;
+  auto &all = benchmarks::registry();
+
+  // Only warnings and errors, such that the results are readable
+  logging::BackendConfiguration config;
+  config.filter = "%Severity% >= warning";
+  logging::setupLogging({config});
+
+  utils::Parallel::initializeMPI(&argc, &argv);
+  // Only the first rank prints
+  if (utils::Parallel::current()->rank() != 0) {
+    std::cout.setstate(std::ios::badbit);
+  }
+
+  if (argc == 2 && std::string(argv[1]) == "list") {
+    for (auto const &benchmark : all) {
+      std::cout << benchmark.first << '\n';
+    }
+    utils::Parallel::finalizeMPI();
+    return 0;
+  }
+
+  std::vector<std::string> selected(argv + 1, argv + argc);
+  for (auto const &name : selected) {
+    if (all.count(name) == 0) {
+      std::cout << "Unknown benchmark \"" << name << "\"\n\n";
+      printUsage();
+      utils::Parallel::finalizeMPI();
+      return 1;
+    }
+  }
+  if (selected.empty()) {
+    for (auto const &benchmark : all) {
+      selected.push_back(benchmark.first);
+    }
+  }
+
+  for (auto const &name : selected) {
+    std::cout << "== " << name << '\n';
+    all[name]();
+    std::cout << std::endl;
+  }
+  utils::Parallel::finalizeMPI();
+  return 0;
+}